@@ -0,0 +1,438 @@
+/**
+ * @file bench_main.cpp
+ * @brief Host benchmark of PLedDisp::update_LEDs()
+ *
+ * Renders N frames for every ModeBG x ModeFR x ModeFG combination against the FastLED/RTClib
+ * shims in sim/shim and reports the time per frame (mean, p50, p99, max) and the number of
+ * heap allocations done while rendering. The simulated clock advances one frame period per
+ * call, the wall clock of the host is only used for measuring.
+ *
+ * Every frame is checked against a time budget, by default the frame period of the refresh rate.
+ * The exit code is 2 if the p99 of any combination is over budget.
+ * Afterwards one rainbow frame is timed with per pixel HSV conversion and with the colour ramp,
+ * and one step of a PLedVm program using the whole instruction budget.
+ *
+ * Usage: bench [frames] [--hz <refresh rate>] [--dither] [--budget <ns>] [--csv <file>] [--baseline <file>] [--profile]
+ * --dither renders with temporal dithering, at PLedDisp's dithering refresh rate unless --hz is given
+ * --baseline compares the mean of every combination with a --csv file of an earlier build
+ * --profile prints the per-stage timings of PLedProfiler, needs a build with -D PLED_PROFILING
+ *
+ * @date 2026-10-15
+ */
+
+#include <FastLED.h>
+#include <RTClib.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "PLedDisp/PLedDisp.h"
+
+// Global Time keeping, normally provided by main.cpp
+RTC_Millis RTC_TIME;
+DateTime TIME_NOW;
+
+//=====ALLOCATION COUNTING=======================================================================
+static unsigned long allocCount = 0;
+
+void* operator new(size_t size) {
+    allocCount++;
+    void* p = malloc(size ? size : 1);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+void operator delete(void* p) noexcept {
+    free(p);
+}
+void operator delete[](void* p) noexcept {
+    free(p);
+}
+void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+void operator delete[](void* p, size_t) noexcept {
+    free(p);
+}
+
+//=====PROFILING=================================================================================
+#ifdef PLED_PROFILING
+static bool profileReport = false;  ///< Print the stage timings of every combination
+
+/**
+ * @brief Print to stdout for PLedProfiler::report()
+ */
+class StdoutPrint : public Print {
+   public:
+    size_t write(uint8_t c) override {
+        return fwrite(&c, 1, 1, stdout);
+    }
+} stdoutPrint;
+#endif
+
+//=====MODES=====================================================================================
+struct BgEntry {
+    PLedDisp::ModeBG mode;
+    const char* name;
+};
+struct FrEntry {
+    PLedDisp::ModeFR mode;
+    const char* name;
+};
+struct FgEntry {
+    PLedDisp::ModeFG mode;
+    const char* name;
+};
+
+static const BgEntry BG_MODES[] = {
+    {PLedDisp::ModeBG::None, "None"},
+    {PLedDisp::ModeBG::SolidColor, "SolidColor"},
+    {PLedDisp::ModeBG::ScrollingRainbow, "ScrollingRainbow"},
+    {PLedDisp::ModeBG::Twinkle, "Twinkle"},
+    {PLedDisp::ModeBG::Fireworks, "Fireworks"},
+    {PLedDisp::ModeBG::Thunderstorm, "Thunderstorm"},
+    {PLedDisp::ModeBG::Firepit, "Firepit"},
+    {PLedDisp::ModeBG::Clip, "Clip"},
+    {PLedDisp::ModeBG::Program, "Program"},
+};
+static const FrEntry FR_MODES[] = {
+    {PLedDisp::ModeFR::None, "None"},
+    {PLedDisp::ModeFR::SolidColor, "SolidColor"},
+    {PLedDisp::ModeFR::Time, "Time"},
+};
+static const FgEntry FG_MODES[] = {
+    {PLedDisp::ModeFG::None, "None"},
+    {PLedDisp::ModeFG::Time, "Time"},
+    {PLedDisp::ModeFG::TimeRainbow, "TimeRainbow"},
+    {PLedDisp::ModeFG::Cycle, "Cycle"},
+    {PLedDisp::ModeFG::Text, "Text"},
+    {PLedDisp::ModeFG::Label, "Label"},
+};
+
+//=====BENCHMARK=================================================================================
+const int DEFAULT_REFRESH_RATE_HZ = 20;  // One animation step per frame
+const int WARMUP_FRAMES = 20;
+const char* BENCH_TEXT = "Paper tomorrow 21`C";  // Text of ModeFG::Text
+const char* BENCH_LABEL = "-12.5`C";              // Label of ModeFG::Label
+
+struct Result {
+    const char* bg;
+    const char* fr;
+    const char* fg;
+    double meanNs;
+    long p50Ns;
+    long p99Ns;
+    long maxNs;
+    unsigned long allocs;
+    unsigned long shown;
+    unsigned long skipped;
+    unsigned long overBudget;  // Frames over the time budget
+};
+
+/**
+ * @brief Render frames with one mode combination and collect the timings
+ */
+static Result runCombination(const BgEntry& bg, const FrEntry& fr, const FgEntry& fg, int frames, int hz, bool dither, long budgetNs,
+                             std::vector<long>& samples) {
+    const unsigned long framePeriodMs = 1000 / hz;
+
+    // Same start conditions for every combination
+    sim::setMillis(0);
+    RTC_TIME.begin(DateTime(2022, 1, 23, 12, 34, 50));
+    TIME_NOW = RTC_TIME.now();
+
+    PLedDisp* disp = new PLedDisp();
+    disp->seedRandom(1);
+    disp->setBackgroundMode(bg.mode);
+    disp->setFrameMode(fr.mode);
+    disp->setForegroundMode(fg.mode, true);
+    disp->setText(BENCH_TEXT);
+    disp->setLabel(BENCH_LABEL);
+    if (dither) {
+        disp->setTemporalDithering(true, hz);
+    } else {
+        disp->setRefreshRate(hz);
+    }
+
+    for (int i = 0; i < WARMUP_FRAMES; i++) {
+        sim::advanceMillis(framePeriodMs);
+        TIME_NOW = RTC_TIME.now();
+        disp->update_LEDs();
+    }
+
+#ifdef PLED_PROFILING
+    disp->getProfiler().reset();
+#endif
+    samples.clear();
+    unsigned long allocsBefore = allocCount;
+    unsigned long shownBefore = FastLED.showCount();
+    unsigned long skippedBefore = disp->getFrameStats().skipped;
+    for (int i = 0; i < frames; i++) {
+        sim::advanceMillis(framePeriodMs);
+        TIME_NOW = RTC_TIME.now();
+
+        if (i == frames / 2) {
+            disp->setWarning(0, false);  // Compiles the plan once in the measured frames, stage plan of --profile
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        disp->update_LEDs();
+        auto stop = std::chrono::steady_clock::now();
+        samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+    }
+
+    Result result = {bg.name, fr.name, fg.name, 0, 0, 0, 0, 0, 0, 0, 0};
+    result.allocs = allocCount - allocsBefore;
+    result.shown = FastLED.showCount() - shownBefore;
+    result.skipped = disp->getFrameStats().skipped - skippedBefore;
+#ifdef PLED_PROFILING
+    if (profileReport) {
+        printf("--- %s / %s / %s\n", bg.name, fr.name, fg.name);
+        disp->getProfiler().report(stdoutPrint);
+    }
+#endif
+    delete disp;
+
+    double sum = 0;
+    for (long s : samples) {
+        sum += s;
+        if (s > budgetNs) {
+            result.overBudget++;
+        }
+    }
+    result.meanNs = sum / samples.size();
+    std::sort(samples.begin(), samples.end());
+    result.p50Ns = samples[samples.size() / 2];
+    result.p99Ns = samples[(samples.size() * 99) / 100];
+    result.maxNs = samples.back();
+    return result;
+}
+
+/**
+ * @brief Print the change of the mean time per combination against a --csv file of an earlier build
+ *
+ * @return false - File not readable
+ */
+static bool compareBaseline(const char* path, const std::vector<Result>& results) {
+    FILE* csv = fopen(path, "r");
+    if (csv == nullptr) {
+        return false;
+    }
+    struct Baseline {
+        std::string key;
+        double meanNs;
+    };
+    std::vector<Baseline> baseline;
+    char line[256];
+    char bg[32], fr[32], fg[32];
+    double meanNs;
+    while (fgets(line, sizeof(line), csv) != nullptr) {
+        if (sscanf(line, "%31[^,],%31[^,],%31[^,],%lf", bg, fr, fg, &meanNs) == 4) {
+            baseline.push_back({std::string(bg) + "/" + fr + "/" + fg, meanNs});
+        }
+    }
+    fclose(csv);
+
+    printf("Compared with %s:\n", path);
+    printf("%-17s %-11s %-12s %10s %10s %8s\n", "ModeBG", "ModeFR", "ModeFG", "base[ns]", "mean[ns]", "gain");
+    double baseTotal = 0;
+    double total = 0;
+    int matched = 0;
+    for (const Result& r : results) {
+        std::string key = std::string(r.bg) + "/" + r.fr + "/" + r.fg;
+        auto it = std::find_if(baseline.begin(), baseline.end(), [&](const Baseline& b) { return b.key == key; });
+        if (it == baseline.end()) {
+            printf("%-17s %-11s %-12s %10s %10.0f %8s\n", r.bg, r.fr, r.fg, "-", r.meanNs, "new");
+            continue;
+        }
+        printf("%-17s %-11s %-12s %10.0f %10.0f %7.1f%%\n",
+               r.bg, r.fr, r.fg, it->meanNs, r.meanNs, (100.0 * (it->meanNs - r.meanNs)) / it->meanNs);
+        baseTotal += it->meanNs;
+        total += r.meanNs;
+        matched++;
+    }
+    if (matched > 0) {
+        printf("%d combinations in both: %.0f ns/frame before, %.0f ns/frame now, gain %.1f%%\n",
+               matched, baseTotal / matched, total / matched, (100.0 * (baseTotal - total)) / baseTotal);
+    }
+    return true;
+}
+
+/**
+ * @brief Time of one rainbow frame (NUM_LEDS hues) converted per pixel and looked up in PLedColorRamp
+ */
+static void benchColorRamp(int frames) {
+    static CRGB pixels[NUM_LEDS];
+    PLedColorRamp ramp;
+    uint32_t check = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int f = 0; f < frames; f++) {
+        for (int i = 0; i < NUM_LEDS; i++) {
+            pixels[i] = CHSV(f + i, 255, 190);
+        }
+        check += pixels[f % NUM_LEDS].r;
+    }
+    auto mid = std::chrono::steady_clock::now();
+    ramp.set(255, 190);
+    auto built = std::chrono::steady_clock::now();
+    for (int f = 0; f < frames; f++) {
+        for (int i = 0; i < NUM_LEDS; i++) {
+            pixels[i] = ramp.at(f + i);
+        }
+        check += pixels[f % NUM_LEDS].r;
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    auto ns = [](std::chrono::steady_clock::duration d) {
+        return double(std::chrono::duration_cast<std::chrono::nanoseconds>(d).count());
+    };
+    printf("Rainbow frame of %d LED's: CHSV %.0f ns, colour ramp %.0f ns, ramp rebuild %.0f ns (check %u)\n",
+           NUM_LEDS, ns(mid - start) / frames, ns(stop - built) / frames, ns(built - mid), (unsigned)check);
+}
+
+/**
+ * @brief Time of one step of a program with PLedVm::INSTRUCTION_BUDGET instructions
+ *
+ * The ESP32 time is estimated with ESP32_SLOWDOWN, a conservative factor between a desktop core
+ * and the 240 MHz Xtensa core for this switch dispatched, branchy code. Check it on the clock
+ * with the Background stage of PLED_PROFILING.
+ */
+static void benchVm(int frames) {
+    const double ESP32_SLOWDOWN = 30;
+    const double STEP_NS = 1e9 / DEFAULT_REFRESH_RATE_HZ;  // One step per frame
+    std::vector<uint8_t> frame = {PLedVm::T};
+    for (int i = 0; i < 63; i++) {
+        frame.insert(frame.end(), {PLedVm::DUP, PLedVm::DROP});
+    }
+    frame.insert(frame.end(), {PLedVm::STORE, 0});
+    std::vector<uint8_t> pixel = {PLedVm::X, PLedVm::PUSH, 16, PLedVm::MUL, PLedVm::Y, PLedVm::PUSH, 16, PLedVm::MUL, PLedVm::NOISE};
+    for (int i = 0; i < 17; i++) {
+        pixel.insert(pixel.end(), {PLedVm::PUSH, 7, PLedVm::ADD, PLedVm::SIN8});
+    }
+    pixel.insert(pixel.end(), {PLedVm::T, PLedVm::ADD, PLedVm::DUP, PLedVm::DUP, PLedVm::HSV});
+    std::vector<uint8_t> program = {'V', PLedVm::FORMAT_VERSION, uint8_t(frame.size()), uint8_t(pixel.size())};
+    program.insert(program.end(), frame.begin(), frame.end());
+    program.insert(program.end(), pixel.begin(), pixel.end());
+
+    uint16_t instructions = 0;
+    PLedVm::Error error = PLedVm::validate(program.data(), program.size(), &instructions);
+    PLedVm vm;
+    PLedLayer layer;
+    PLedRandom rng;
+    if ((error != PLedVm::Error::Ok) || (vm.load(program.data(), program.size()) != PLedVm::Error::Ok)) {
+        printf("VM benchmark program rejected: %s\n", PLedVm::errorText(error));
+        return;
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (int f = 0; f < frames; f++) {
+        layer.begin();
+        vm.run(layer, rng);
+    }
+    auto stop = std::chrono::steady_clock::now();
+    double ns = double(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count()) / frames;
+    printf("VM step of %u instructions for %d LED's: %.0f ns, %.2f ns/instruction, ESP32 estimate (x%.0f) %.2f ms = %.1f%% of a %d Hz step\n",
+           instructions, NUM_LEDS, ns, ns / instructions, ESP32_SLOWDOWN, ns * ESP32_SLOWDOWN / 1e6,
+           (100.0 * ns * ESP32_SLOWDOWN) / STEP_NS, DEFAULT_REFRESH_RATE_HZ);
+}
+
+int main(int argc, char** argv) {
+    int frames = 2000;
+    int hz = 0;
+    bool dither = false;
+    long budgetNs = 0;
+    const char* csvPath = nullptr;
+    const char* baselinePath = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if ((strcmp(argv[i], "--csv") == 0) && (i + 1 < argc)) {
+            csvPath = argv[++i];
+        } else if ((strcmp(argv[i], "--baseline") == 0) && (i + 1 < argc)) {
+            baselinePath = argv[++i];
+        } else if ((strcmp(argv[i], "--hz") == 0) && (i + 1 < argc)) {
+            hz = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--dither") == 0) {
+            dither = true;
+        } else if ((strcmp(argv[i], "--budget") == 0) && (i + 1 < argc)) {
+            budgetNs = atol(argv[++i]);
+#ifdef PLED_PROFILING
+        } else if (strcmp(argv[i], "--profile") == 0) {
+            profileReport = true;
+#endif
+        } else {
+            frames = atoi(argv[i]);
+        }
+    }
+    if (hz == 0) {
+        hz = dither ? DITHER_REFRESH_RATE_HZ : DEFAULT_REFRESH_RATE_HZ;
+    }
+    if (budgetNs == 0) {
+        budgetNs = 1000000000L / hz;
+    }
+    if ((frames <= 0) || (hz <= 0) || (hz > 255) || (budgetNs < 0)) {
+        fprintf(stderr, "Usage: %s [frames] [--hz <refresh rate>] [--dither] [--budget <ns>] [--csv <file>] [--baseline <file>] [--profile]\n", argv[0]);
+        return 1;
+    }
+
+    std::vector<long> samples;
+    samples.reserve(frames);
+    std::vector<Result> results;
+
+    for (const BgEntry& bg : BG_MODES) {
+        for (const FrEntry& fr : FR_MODES) {
+            for (const FgEntry& fg : FG_MODES) {
+                results.push_back(runCombination(bg, fr, fg, frames, hz, dither, budgetNs, samples));
+            }
+        }
+    }
+
+    printf("%d frames at %d Hz%s per combination, %zu combinations, budget %ld ns/frame\n",
+           frames, hz, dither ? " with temporal dithering" : "", results.size(), budgetNs);
+    printf("%-17s %-11s %-12s %10s %10s %10s %10s %7s %7s %7s %7s\n",
+           "ModeBG", "ModeFR", "ModeFG", "mean[ns]", "p50[ns]", "p99[ns]", "max[ns]", "allocs", "shown", "skipped", "over");
+    double total = 0;
+    long worstP99 = 0;
+    int p99OverBudget = 0;
+    for (const Result& r : results) {
+        printf("%-17s %-11s %-12s %10.0f %10ld %10ld %10ld %7lu %7lu %7lu %7lu\n",
+               r.bg, r.fr, r.fg, r.meanNs, r.p50Ns, r.p99Ns, r.maxNs, r.allocs, r.shown, r.skipped, r.overBudget);
+        total += r.meanNs;
+        worstP99 = std::max(worstP99, r.p99Ns);
+        if (r.p99Ns > budgetNs) {
+            p99OverBudget++;
+        }
+    }
+    printf("Average over all combinations: %.0f ns/frame\n", total / results.size());
+    printf("Worst p99: %ld ns = %.1f%% of the budget, %d combinations with p99 over budget\n",
+           worstP99, (100.0 * worstP99) / budgetNs, p99OverBudget);
+    if ((baselinePath != nullptr) && !compareBaseline(baselinePath, results)) {
+        fprintf(stderr, "Cannot read %s\n", baselinePath);
+        return 1;
+    }
+    benchColorRamp(frames);
+    benchVm(frames);
+
+    if (csvPath != nullptr) {
+        FILE* csv = fopen(csvPath, "w");
+        if (csv == nullptr) {
+            fprintf(stderr, "Cannot write %s\n", csvPath);
+            return 1;
+        }
+        fprintf(csv, "bg,fr,fg,mean_ns,p50_ns,p99_ns,max_ns,allocs,shown,skipped,over_budget\n");
+        for (const Result& r : results) {
+            fprintf(csv, "%s,%s,%s,%.0f,%ld,%ld,%ld,%lu,%lu,%lu,%lu\n",
+                    r.bg, r.fr, r.fg, r.meanNs, r.p50Ns, r.p99Ns, r.maxNs, r.allocs, r.shown, r.skipped, r.overBudget);
+        }
+        fclose(csv);
+    }
+    return (p99OverBudget > 0) ? 2 : 0;
+}
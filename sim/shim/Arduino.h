@@ -0,0 +1,111 @@
+/**
+ * @file Arduino.h
+ * @brief Host shim of the Arduino core for the native simulation build.
+ *
+ * Only provides what PLedDisp needs. The clock is simulated: millis() and micros()
+ * only move when the simulation advances them, so every run is reproducible.
+ *
+ * @date 2026-10-15
+ */
+
+#pragma once
+
+#include <sys/types.h>  // uint
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+namespace sim {
+inline unsigned long clockUs = 0;     ///< Simulated time since boot [us]
+inline uint32_t randomState = 1;      ///< State of the Arduino random() generator
+
+/**
+ * @brief Set the simulated time
+ *
+ * @param ms - Milliseconds since boot
+ */
+inline void setMillis(unsigned long ms) {
+    clockUs = ms * 1000UL;
+}
+
+/**
+ * @brief Advance the simulated time
+ *
+ * @param ms - Milliseconds to add
+ */
+inline void advanceMillis(unsigned long ms) {
+    clockUs += ms * 1000UL;
+}
+}  // namespace sim
+
+inline unsigned long millis() {
+    return sim::clockUs / 1000UL;
+}
+
+inline unsigned long micros() {
+    return sim::clockUs;
+}
+
+inline void delay(unsigned long ms) {
+    sim::advanceMillis(ms);
+}
+
+inline void randomSeed(unsigned long seed) {
+    sim::randomState = seed ? seed : 1;
+}
+
+inline long random(long howbig) {
+    if (howbig <= 0) {
+        return 0;
+    }
+    sim::randomState = sim::randomState * 1103515245UL + 12345UL;
+    return (sim::randomState >> 1) % howbig;
+}
+
+inline long random(long howsmall, long howbig) {
+    if (howsmall >= howbig) {
+        return howsmall;
+    }
+    return random(howbig - howsmall) + howsmall;
+}
+
+/**
+ * @brief Byte sink like the Arduino Print class, e.g. for reports to stdout
+ */
+class Print {
+   public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+
+    virtual size_t write(const uint8_t *buffer, size_t size) {
+        size_t n = 0;
+        while (size--) {
+            n += write(*buffer++);
+        }
+        return n;
+    }
+
+    size_t print(const char *str) {
+        return write(reinterpret_cast<const uint8_t *>(str), strlen(str));
+    }
+
+    size_t print(unsigned long value) {
+        char buffer[24];
+        snprintf(buffer, sizeof(buffer), "%lu", value);
+        return print(buffer);
+    }
+
+    size_t println(const char *str = "") {
+        return print(str) + print("\r\n");
+    }
+
+    size_t println(unsigned long value) {
+        return print(value) + println();
+    }
+};
@@ -0,0 +1,531 @@
+/**
+ * @file FastLED.h
+ * @brief Host shim of FastLED for the native simulation build.
+ *
+ * Mirrors the parts of the FastLED API used by PLedDisp (CRGB, CHSV, 16 entry palettes, the 8-bit
+ * math and random helpers, the FastLED controller object). Colour conversion and random8 follow
+ * the FastLED 3.5 algorithms so that frame content and cost are comparable to the target.
+ * FastLED.show() does not transmit anything, it only counts frames.
+ *
+ * @date 2026-10-15
+ */
+
+#pragma once
+
+#include "Arduino.h"
+
+//=====8-BIT MATH================================================================================
+inline uint8_t scale8(uint8_t i, uint8_t scale) {
+    return ((uint16_t)i * (1 + (uint16_t)scale)) >> 8;
+}
+
+inline uint8_t scale8_video(uint8_t i, uint8_t scale) {
+    return (((int)i * (int)scale) >> 8) + ((i && scale) ? 1 : 0);
+}
+
+inline uint8_t qadd8(uint8_t i, uint8_t j) {
+    unsigned int t = i + j;
+    return (t > 255) ? 255 : t;
+}
+
+inline uint8_t qsub8(uint8_t i, uint8_t j) {
+    int t = i - j;
+    return (t < 0) ? 0 : t;
+}
+
+/**
+ * @brief Port of FastLED's sin8_C, sine of 0--255 as one period, result 0--255
+ */
+inline uint8_t sin8(uint8_t theta) {
+    static const uint8_t b_m16_interleave[] = {0, 49, 49, 41, 90, 27, 117, 10};
+    uint8_t offset = theta;
+    if (theta & 0x40) {
+        offset = (uint8_t)255 - offset;
+    }
+    offset &= 0x3F;
+    uint8_t secoffset = offset & 0x0F;
+    if (theta & 0x40) {
+        ++secoffset;
+    }
+    uint8_t s2 = (offset >> 4) * 2;
+    uint8_t b = b_m16_interleave[s2];
+    uint8_t m16 = b_m16_interleave[s2 + 1];
+    uint8_t mx = (m16 * secoffset) >> 4;
+    int8_t y = mx + b;
+    if (theta & 0x80) {
+        y = -y;
+    }
+    y += 128;
+    return y;
+}
+
+//=====RANDOM====================================================================================
+namespace sim {
+inline uint16_t rand16seed = 1337;  ///< Same seed and generator as FastLED lib8tion
+}
+
+inline uint8_t random8() {
+    sim::rand16seed = (sim::rand16seed * 2053) + 13849;
+    return (uint8_t)(((uint8_t)(sim::rand16seed & 0xFF)) + ((uint8_t)(sim::rand16seed >> 8)));
+}
+
+inline uint8_t random8(uint8_t lim) {
+    uint8_t r = random8();
+    r = ((uint16_t)r * lim) >> 8;
+    return r;
+}
+
+inline uint8_t random8(uint8_t min, uint8_t lim) {
+    uint8_t delta = lim - min;
+    uint8_t r = random8(delta) + min;
+    return r;
+}
+
+inline uint16_t random16() {
+    sim::rand16seed = (sim::rand16seed * 2053) + 13849;
+    return sim::rand16seed;
+}
+
+inline void random16_set_seed(uint16_t seed) {
+    sim::rand16seed = seed;
+}
+
+//=====COLOUR====================================================================================
+enum HSVHue {
+    HUE_RED = 0,
+    HUE_ORANGE = 32,
+    HUE_YELLOW = 64,
+    HUE_GREEN = 96,
+    HUE_AQUA = 128,
+    HUE_BLUE = 160,
+    HUE_PURPLE = 192,
+    HUE_PINK = 224
+};
+
+enum LEDColorCorrection {
+    TypicalSMD5050 = 0xFFB0F0,
+    TypicalLEDStrip = 0xFFB0F0,
+    UncorrectedColor = 0xFFFFFF
+};
+
+struct CHSV {
+    union {
+        struct {
+            union {
+                uint8_t hue;
+                uint8_t h;
+            };
+            union {
+                uint8_t saturation;
+                uint8_t sat;
+                uint8_t s;
+            };
+            union {
+                uint8_t value;
+                uint8_t val;
+                uint8_t v;
+            };
+        };
+        uint8_t raw[3];
+    };
+
+    CHSV() = default;
+    constexpr CHSV(uint8_t ih, uint8_t is, uint8_t iv) : h(ih), s(is), v(iv) {}
+};
+
+struct CRGB;
+void hsv2rgb_rainbow(const CHSV &hsv, CRGB &rgb);
+
+struct CRGB {
+    union {
+        struct {
+            union {
+                uint8_t r;
+                uint8_t red;
+            };
+            union {
+                uint8_t g;
+                uint8_t green;
+            };
+            union {
+                uint8_t b;
+                uint8_t blue;
+            };
+        };
+        uint8_t raw[3];
+    };
+
+    typedef enum {
+        Aqua = 0x00FFFF,
+        Beige = 0xF5F5DC,
+        Black = 0x000000,
+        Blue = 0x0000FF,
+        Cyan = 0x00FFFF,
+        DarkBlue = 0x00008B,
+        DarkGray = 0xA9A9A9,
+        DarkGrey = 0xA9A9A9,
+        DarkOrange = 0xFF8C00,
+        DarkRed = 0x8B0000,
+        Gold = 0xFFD700,
+        Gray = 0x808080,
+        Green = 0x008000,
+        Grey = 0x808080,
+        LightBlue = 0xADD8E6,
+        LightGrey = 0xD3D3D3,
+        Magenta = 0xFF00FF,
+        MediumBlue = 0x0000CD,
+        MidnightBlue = 0x191970,
+        Navy = 0x000080,
+        Orange = 0xFFA500,
+        OrangeRed = 0xFF4500,
+        Peru = 0xCD853F,
+        Purple = 0x800080,
+        Red = 0xFF0000,
+        Teal = 0x008080,
+        White = 0xFFFFFF,
+        WhiteSmoke = 0xF5F5F5,
+        Yellow = 0xFFFF00
+    } HTMLColorCode;
+
+    CRGB() = default;
+    constexpr CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+    constexpr CRGB(uint32_t colorcode) : r((colorcode >> 16) & 0xFF), g((colorcode >> 8) & 0xFF), b((colorcode >> 0) & 0xFF) {}
+    constexpr CRGB(LEDColorCorrection colorcode) : r((colorcode >> 16) & 0xFF), g((colorcode >> 8) & 0xFF), b((colorcode >> 0) & 0xFF) {}
+    constexpr CRGB(HTMLColorCode colorcode) : r((colorcode >> 16) & 0xFF), g((colorcode >> 8) & 0xFF), b((colorcode >> 0) & 0xFF) {}
+    CRGB(const CHSV &rhs) {
+        hsv2rgb_rainbow(rhs, *this);
+    }
+
+    inline uint8_t &operator[](uint8_t x) {
+        return raw[x];
+    }
+    inline const uint8_t &operator[](uint8_t x) const {
+        return raw[x];
+    }
+
+    inline CRGB &operator=(const CHSV &rhs) {
+        hsv2rgb_rainbow(rhs, *this);
+        return *this;
+    }
+
+    inline CRGB &operator+=(const CRGB &rhs) {
+        r = qadd8(r, rhs.r);
+        g = qadd8(g, rhs.g);
+        b = qadd8(b, rhs.b);
+        return *this;
+    }
+
+    inline CRGB &nscale8(uint8_t scaledown) {
+        r = scale8(r, scaledown);
+        g = scale8(g, scaledown);
+        b = scale8(b, scaledown);
+        return *this;
+    }
+
+    inline CRGB &fadeToBlackBy(uint8_t fadefactor) {
+        return nscale8(255 - fadefactor);
+    }
+
+    inline explicit operator bool() const {
+        return r || g || b;
+    }
+};
+
+inline bool operator==(const CRGB &lhs, const CRGB &rhs) {
+    return (lhs.r == rhs.r) && (lhs.g == rhs.g) && (lhs.b == rhs.b);
+}
+
+inline bool operator!=(const CRGB &lhs, const CRGB &rhs) {
+    return !(lhs == rhs);
+}
+
+/**
+ * @brief Port of FastLED's blend8 (FASTLED_BLEND_FIXED), a + (b - a) * amountOfB / 256
+ */
+inline uint8_t blend8(uint8_t a, uint8_t b, uint8_t amountOfB) {
+    uint16_t partial = (a << 8) | b;
+    partial += b * amountOfB;
+    partial -= a * amountOfB;
+    return partial >> 8;
+}
+
+/**
+ * @brief Port of FastLED's blend of two colours
+ */
+inline CRGB blend(const CRGB &p1, const CRGB &p2, uint8_t amountOfP2) {
+    return CRGB(blend8(p1.r, p2.r, amountOfP2), blend8(p1.g, p2.g, amountOfP2), blend8(p1.b, p2.b, amountOfP2));
+}
+
+/**
+ * @brief Port of FastLED's hsv2rgb_rainbow (Y1 yellow, no green reduction)
+ */
+inline void hsv2rgb_rainbow(const CHSV &hsv, CRGB &rgb) {
+    uint8_t hue = hsv.hue;
+    uint8_t sat = hsv.sat;
+    uint8_t val = hsv.val;
+
+    uint8_t offset8 = (hue & 0x1F) << 3;
+    uint8_t third = scale8(offset8, (256 / 3));
+    uint8_t r, g, b;
+
+    if (!(hue & 0x80)) {
+        if (!(hue & 0x40)) {
+            if (!(hue & 0x20)) {  // R -> O
+                r = 255 - third;
+                g = third;
+                b = 0;
+            } else {  // O -> Y
+                r = 171;
+                g = 85 + third;
+                b = 0;
+            }
+        } else {
+            if (!(hue & 0x20)) {  // Y -> G
+                uint8_t twothirds = scale8(offset8, ((256 * 2) / 3));
+                r = 171 - twothirds;
+                g = 170 + third;
+                b = 0;
+            } else {  // G -> A
+                r = 0;
+                g = 255 - third;
+                b = third;
+            }
+        }
+    } else {
+        if (!(hue & 0x40)) {
+            if (!(hue & 0x20)) {  // A -> B
+                uint8_t twothirds = scale8(offset8, ((256 * 2) / 3));
+                r = 0;
+                g = 171 - twothirds;
+                b = 85 + twothirds;
+            } else {  // B -> P
+                r = third;
+                g = 0;
+                b = 255 - third;
+            }
+        } else {
+            if (!(hue & 0x20)) {  // P -> K
+                r = 85 + third;
+                g = 0;
+                b = 171 - third;
+            } else {  // K -> R
+                r = 170 + third;
+                g = 0;
+                b = 85 - third;
+            }
+        }
+    }
+
+    if (sat != 255) {
+        if (sat == 0) {
+            r = 255;
+            b = 255;
+            g = 255;
+        } else {
+            uint8_t desat = 255 - sat;
+            desat = scale8_video(desat, desat);
+            uint8_t satscale = 255 - desat;
+            if (r) r = scale8(r, satscale) + 1;
+            if (g) g = scale8(g, satscale) + 1;
+            if (b) b = scale8(b, satscale) + 1;
+            r += desat;
+            g += desat;
+            b += desat;
+        }
+    }
+
+    if (val != 255) {
+        val = scale8_video(val, val);
+        if (val == 0) {
+            r = 0;
+            g = 0;
+            b = 0;
+        } else {
+            if (r) r = scale8(r, val) + 1;
+            if (g) g = scale8(g, val) + 1;
+            if (b) b = scale8(b, val) + 1;
+        }
+    }
+
+    rgb.r = r;
+    rgb.g = g;
+    rgb.b = b;
+}
+
+//=====PALETTES==================================================================================
+typedef uint32_t TProgmemRGBPalette16[16];
+
+enum TBlendType { NOBLEND = 0,
+                  LINEARBLEND = 1 };
+
+class CRGBPalette16 {
+   public:
+    CRGB entries[16];
+
+    CRGBPalette16() = default;
+    CRGBPalette16(const CRGB &c) {
+        for (uint8_t i = 0; i < 16; i++) {
+            entries[i] = c;
+        }
+    }
+    CRGBPalette16(const TProgmemRGBPalette16 &rhs) {
+        for (uint8_t i = 0; i < 16; i++) {
+            entries[i] = CRGB(rhs[i]);
+        }
+    }
+
+    inline CRGB &operator[](uint8_t x) {
+        return entries[x];
+    }
+    inline const CRGB &operator[](uint8_t x) const {
+        return entries[x];
+    }
+};
+
+const TProgmemRGBPalette16 RainbowColors_p = {
+    0xFF0000, 0xD52A00, 0xAB5500, 0xAB7F00, 0xABAB00, 0x56D500, 0x00FF00, 0x00D52A,
+    0x00AB55, 0x0056AA, 0x0000FF, 0x2A00D5, 0x5500AB, 0x7F0081, 0xAB0055, 0xD5002B};
+
+const TProgmemRGBPalette16 HeatColors_p = {
+    0x000000, 0x330000, 0x660000, 0x990000, 0xCC0000, 0xFF0000, 0xFF3300, 0xFF6600,
+    0xFF9900, 0xFFCC00, 0xFFFF00, 0xFFFF33, 0xFFFF66, 0xFFFF99, 0xFFFFCC, 0xFFFFFF};
+
+/**
+ * @brief Port of FastLED's ColorFromPalette for 16 entry palettes
+ */
+inline CRGB ColorFromPalette(const CRGBPalette16 &pal, uint8_t index, uint8_t brightness = 255, TBlendType blendType = LINEARBLEND) {
+    uint8_t hi4 = index >> 4;
+    uint8_t lo4 = index & 0x0F;
+    const CRGB *entry = &pal[hi4];
+    uint8_t red1 = entry->r;
+    uint8_t green1 = entry->g;
+    uint8_t blue1 = entry->b;
+
+    if (lo4 && (blendType != NOBLEND)) {
+        entry = (hi4 == 15) ? &pal[0] : entry + 1;
+        uint8_t f2 = lo4 << 4;
+        uint8_t f1 = 255 - f2;
+        red1 = scale8(red1, f1) + scale8(entry->r, f2);
+        green1 = scale8(green1, f1) + scale8(entry->g, f2);
+        blue1 = scale8(blue1, f1) + scale8(entry->b, f2);
+    }
+
+    if (brightness != 255) {
+        if (brightness) {
+            brightness++;  // adjust for rounding
+            red1 = scale8(red1, brightness);
+            green1 = scale8(green1, brightness);
+            blue1 = scale8(blue1, brightness);
+        } else {
+            red1 = 0;
+            green1 = 0;
+            blue1 = 0;
+        }
+    }
+    return CRGB(red1, green1, blue1);
+}
+
+//=====CONTROLLER================================================================================
+enum EOrder { RGB = 0012,
+              GRB = 0102 };
+
+template <uint8_t DATA_PIN, EOrder RGB_ORDER = GRB>
+class WS2812 {};
+
+class CLEDController {
+   public:
+    CLEDController &setCorrection(CRGB correction) {
+        m_correction = correction;
+        return *this;
+    }
+    CLEDController &setLeds(CRGB *data, int nLeds) {
+        m_data = data;
+        m_nLeds = nLeds;
+        return *this;
+    }
+    CRGB *leds() {
+        return m_data;
+    }
+    int size() const {
+        return m_nLeds;
+    }
+
+   private:
+    CRGB *m_data = nullptr;
+    int m_nLeds = 0;
+    CRGB m_correction = CRGB(255, 255, 255);
+};
+
+#define DISABLE_DITHER 0x00
+#define BINARY_DITHER 0x01
+
+class CFastLED {
+   public:
+    template <template <uint8_t DATA_PIN, EOrder RGB_ORDER> class CHIPSET, uint8_t DATA_PIN, EOrder RGB_ORDER>
+    CLEDController &addLeds(CRGB *data, int nLedsOrOffset, int nLedsIfOffset = 0) {
+        int nLeds = (nLedsIfOffset > 0) ? nLedsIfOffset : nLedsOrOffset;
+        int offset = (nLedsIfOffset > 0) ? nLedsOrOffset : 0;
+        return m_controller.setLeds(data + offset, nLeds);
+    }
+
+    void setMaxPowerInVoltsAndMilliamps(uint8_t volts, uint32_t milliamps) {
+        m_powerMilliwatts = volts * milliamps;
+    }
+    void setMaxRefreshRate(uint16_t refresh, bool constrain = false) {
+        m_maxRefreshRate = refresh;
+    }
+    void setBrightness(uint8_t scale) {
+        m_scale = scale;
+    }
+    uint8_t getBrightness() const {
+        return m_scale;
+    }
+    void setDither(uint8_t ditherMode = 1) {
+        m_dither = ditherMode;
+    }
+
+    void clear(bool writeData = false) {
+        if (m_controller.leds()) {
+            memset(m_controller.leds(), 0, sizeof(CRGB) * m_controller.size());
+        }
+        if (writeData) {
+            show();
+        }
+    }
+    void show() {
+        show(m_scale);
+    }
+    void show(uint8_t scale) {
+        m_showCount++;
+    }
+
+    CLEDController &operator[](int x) {
+        return m_controller;
+    }
+    CRGB *leds() {
+        return m_controller.leds();
+    }
+    int size() {
+        return m_controller.size();
+    }
+    int count() const {
+        return 1;
+    }
+
+    /**
+     * @brief Simulation only: number of frames pushed to the strip since start
+     */
+    unsigned long showCount() const {
+        return m_showCount;
+    }
+
+   private:
+    CLEDController m_controller;
+    uint8_t m_scale = 255;
+    uint8_t m_dither = 1;
+    uint16_t m_maxRefreshRate = 0;
+    uint32_t m_powerMilliwatts = 0;
+    unsigned long m_showCount = 0;
+};
+
+inline CFastLED FastLED;
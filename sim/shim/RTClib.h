@@ -0,0 +1,148 @@
+/**
+ * @file RTClib.h
+ * @brief Host shim of Adafruit RTClib for the native simulation build.
+ *
+ * Provides DateTime, TimeSpan and RTC_Millis with the same calendar arithmetic as RTClib
+ * (valid for 2000--2099). RTC_Millis follows the simulated millis() clock.
+ *
+ * @date 2026-10-15
+ */
+
+#pragma once
+
+#include "Arduino.h"
+
+const uint32_t SECONDS_FROM_1970_TO_2000 = 946684800;
+
+class TimeSpan {
+   public:
+    TimeSpan(int32_t seconds = 0) : _seconds(seconds) {}
+    TimeSpan(int16_t days, int8_t hours, int8_t minutes, int8_t seconds)
+        : _seconds((int32_t)days * 86400L + (int32_t)hours * 3600 + (int32_t)minutes * 60 + seconds) {}
+
+    int32_t totalseconds() const {
+        return _seconds;
+    }
+
+   protected:
+    int32_t _seconds;
+};
+
+class DateTime {
+   public:
+    DateTime(uint32_t t = SECONDS_FROM_1970_TO_2000) {
+        t -= SECONDS_FROM_1970_TO_2000;
+        ss = t % 60;
+        t /= 60;
+        mm = t % 60;
+        t /= 60;
+        hh = t % 24;
+        uint16_t days = t / 24;
+        uint8_t leap;
+        for (yOff = 0;; ++yOff) {
+            leap = yOff % 4 == 0;
+            if (days < 365U + leap)
+                break;
+            days -= 365 + leap;
+        }
+        for (m = 1; m < 12; ++m) {
+            uint8_t daysPerMonth = daysInMonth(m - 1);
+            if (leap && m == 2)
+                ++daysPerMonth;
+            if (days < daysPerMonth)
+                break;
+            days -= daysPerMonth;
+        }
+        d = days + 1;
+    }
+
+    DateTime(uint16_t year, uint8_t month, uint8_t day, uint8_t hour = 0, uint8_t min = 0, uint8_t sec = 0)
+        : yOff(year >= 2000 ? year - 2000 : year), m(month), d(day), hh(hour), mm(min), ss(sec) {}
+
+    uint16_t year() const {
+        return 2000U + yOff;
+    }
+    uint8_t month() const {
+        return m;
+    }
+    uint8_t day() const {
+        return d;
+    }
+    uint8_t hour() const {
+        return hh;
+    }
+    uint8_t minute() const {
+        return mm;
+    }
+    uint8_t second() const {
+        return ss;
+    }
+
+    uint8_t dayOfTheWeek() const {
+        uint16_t day = date2days();
+        return (day + 6) % 7;  // Jan 1, 2000 is a Saturday, i.e. returns 6
+    }
+
+    uint32_t secondstime() const {
+        return time2ulong(date2days(), hh, mm, ss);
+    }
+
+    uint32_t unixtime() const {
+        return secondstime() + SECONDS_FROM_1970_TO_2000;
+    }
+
+    DateTime operator+(const TimeSpan &span) const {
+        return DateTime(unixtime() + span.totalseconds());
+    }
+    DateTime operator-(const TimeSpan &span) const {
+        return DateTime(unixtime() - span.totalseconds());
+    }
+
+   protected:
+    uint8_t yOff;
+    uint8_t m;
+    uint8_t d;
+    uint8_t hh;
+    uint8_t mm;
+    uint8_t ss;
+
+   private:
+    static uint8_t daysInMonth(uint8_t idx) {
+        static const uint8_t daysInMonth[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30};
+        return daysInMonth[idx];
+    }
+
+    uint16_t date2days() const {
+        uint16_t days = d;
+        for (uint8_t i = 1; i < m; ++i)
+            days += daysInMonth(i - 1);
+        if (m > 2 && yOff % 4 == 0)
+            ++days;
+        return days + 365 * yOff + (yOff + 3) / 4 - 1;
+    }
+
+    static uint32_t time2ulong(uint16_t days, uint8_t h, uint8_t m, uint8_t s) {
+        return ((days * 24UL + h) * 60 + m) * 60 + s;
+    }
+};
+
+class RTC_Millis {
+   public:
+    void begin(const DateTime &dt) {
+        adjust(dt);
+    }
+    void adjust(const DateTime &dt) {
+        lastMillis = millis();
+        lastUnix = dt.unixtime();
+    }
+    DateTime now() {
+        uint32_t elapsedSeconds = (millis() - lastMillis) / 1000;
+        lastMillis += elapsedSeconds * 1000;
+        lastUnix += elapsedSeconds;
+        return lastUnix;
+    }
+
+   protected:
+    uint32_t lastUnix = SECONDS_FROM_1970_TO_2000;
+    uint32_t lastMillis = 0;
+};
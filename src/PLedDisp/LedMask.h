@@ -0,0 +1,110 @@
+/**
+ * @file LedMask.h
+ * @brief Bitset with one bit per LED of the display
+ *
+ * Used as coverage mask of the compositor layers ("which LEDs does this layer draw").
+ *
+ * @date 2026-10-15
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+struct LedMask {
+    static const uint8_t WORDS = 4;         // 32 bit words
+    static const uint8_t BITS = 32 * WORDS;  // Max. nbr of LED's
+
+    uint32_t w[WORDS] = {};
+
+    constexpr void set(uint8_t i) {
+        w[i >> 5] |= (1UL << (i & 31));
+    }
+
+    constexpr void clear(uint8_t i) {
+        w[i >> 5] &= ~(1UL << (i & 31));
+    }
+
+    constexpr bool test(uint8_t i) const {
+        return (w[i >> 5] >> (i & 31)) & 1UL;
+    }
+
+    constexpr void reset() {
+        for (uint8_t k = 0; k < WORDS; k++) {
+            w[k] = 0;
+        }
+    }
+
+    constexpr void setAll() {
+        for (uint8_t k = 0; k < WORDS; k++) {
+            w[k] = 0xFFFFFFFFUL;
+        }
+    }
+
+    constexpr bool any() const {
+        return (w[0] | w[1] | w[2] | w[3]) != 0;
+    }
+
+    /**
+     * @brief Number of set bits
+     */
+    inline uint8_t count() const {
+        uint8_t n = 0;
+        for (uint8_t k = 0; k < WORDS; k++) {
+            n += __builtin_popcountl(w[k]);
+        }
+        return n;
+    }
+
+    /**
+     * @brief Call f(index) for every set bit in ascending order
+     */
+    template <typename F>
+    inline void forEach(F f) const {
+        for (uint8_t k = 0; k < WORDS; k++) {
+            uint32_t bits = w[k];
+            while (bits) {
+                f(uint8_t((k << 5) + __builtin_ctzl(bits)));
+                bits &= bits - 1;
+            }
+        }
+    }
+
+    constexpr LedMask &operator|=(const LedMask &rhs) {
+        for (uint8_t k = 0; k < WORDS; k++) {
+            w[k] |= rhs.w[k];
+        }
+        return *this;
+    }
+
+    constexpr LedMask &operator&=(const LedMask &rhs) {
+        for (uint8_t k = 0; k < WORDS; k++) {
+            w[k] &= rhs.w[k];
+        }
+        return *this;
+    }
+
+    constexpr LedMask operator~() const {
+        LedMask result;
+        for (uint8_t k = 0; k < WORDS; k++) {
+            result.w[k] = ~w[k];
+        }
+        return result;
+    }
+
+    constexpr bool operator==(const LedMask &rhs) const {
+        return (w[0] == rhs.w[0]) && (w[1] == rhs.w[1]) && (w[2] == rhs.w[2]) && (w[3] == rhs.w[3]);
+    }
+
+    constexpr bool operator!=(const LedMask &rhs) const {
+        return !(*this == rhs);
+    }
+};
+
+constexpr LedMask operator|(LedMask lhs, const LedMask &rhs) {
+    return lhs |= rhs;
+}
+
+constexpr LedMask operator&(LedMask lhs, const LedMask &rhs) {
+    return lhs &= rhs;
+}
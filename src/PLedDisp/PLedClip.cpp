@@ -0,0 +1,98 @@
+/**
+ * @file PLedClip.cpp
+ * @date 2026-10-15
+ *
+ */
+
+#include "PLedClip.h"
+
+uint8_t PLedFlashClip::read(uint8_t *dst, uint8_t n) {
+    if (n > size - pos) {
+        n = size - pos;
+    }
+    PLED_READ_BLOCK(dst, data + pos, n);
+    pos += n;
+    return n;
+}
+
+void PLedFlashClip::seek(uint16_t offset) {
+    pos = (offset < size) ? offset : size;
+}
+
+bool PLedClipPlayer::begin(PLedClipSource *clip) {
+    stop();
+    if (clip == nullptr) {
+        return false;
+    }
+    uint8_t header[HEADER_SIZE];
+    clip->seek(0);
+    if ((clip->read(header, HEADER_SIZE) != HEADER_SIZE) || (header[0] != 'P') || (header[1] != 'L') || (header[2] != 'C') ||
+        (header[3] != FORMAT_VERSION)) {
+        return false;
+    }
+    loop = header[4] & FLAG_LOOP;
+    frameCount = header[5] | (header[6] << 8);
+    frame = 0;
+    hold = 0;
+    source = clip;
+    return true;
+}
+
+bool PLedClipPlayer::step(PLedLayer &layer) {
+    if (source == nullptr) {
+        return false;
+    }
+    if (hold > 1) {
+        hold--;
+        return false;
+    }
+    if (frame == frameCount) {
+        if (!loop || (frameCount == 0)) {
+            stop();
+            return false;
+        }
+        source->seek(HEADER_SIZE);
+        frame = 0;
+    }
+    if (frame == 0) {
+        layer.begin();
+    }
+
+    uint8_t buf[3];
+    if (source->read(buf, 2) != 2) {
+        stop();
+        return false;
+    }
+    hold = buf[0];
+    uint8_t runs = buf[1];
+    uint16_t led = 0;
+    for (uint8_t r = 0; r < runs; r++) {
+        if (source->read(buf, 2) != 2) {
+            stop();
+            break;
+        }
+        led += buf[0];
+        uint8_t length = buf[1] & RUN_LENGTH;
+        if (led + length > PLedGeometry::LED_COUNT) {
+            stop();  // Not a clip of this display
+            break;
+        }
+        if (buf[1] & OFF_RUN) {
+            for (uint8_t i = 0; i < length; i++) {
+                layer.mask.clear(led++);
+            }
+            continue;
+        }
+        if (source->read(buf, 3) != 3) {
+            stop();
+            break;
+        }
+        CRGB color(buf[0], buf[1], buf[2]);
+        for (uint8_t i = 0; i < length; i++) {
+            layer.put(led++, color);
+        }
+    }
+    layer.dirty = true;
+    frame++;
+    return true;
+}
@@ -0,0 +1,127 @@
+/**
+ * @file PLedClip.h
+ * @brief Keyframe animation clips streamed from flash or a file into a layer
+ *
+ * A clip is a list of keyframes. Every keyframe stores only the LED's changed since the one
+ * before, as runs of LED's set to one colour or turned off, and how many animation steps it is
+ * shown. The player reads one keyframe at a time from the source, so a clip never has to fit
+ * into RAM, and does nothing in the steps in between. Clips are written as text and converted
+ * with tools/clipc.py, which also documents the binary format.
+ *
+ * @date 2026-10-15
+ */
+
+#pragma once
+
+#include <FastLED.h>
+#ifdef BUILD_FOR_ESP32
+#include <FS.h>
+#endif
+
+#include "PLedCompositor.h"
+#include "PLedGeometry.h"
+
+/**
+ * @brief Bytes of a clip
+ */
+class PLedClipSource {
+   public:
+    virtual ~PLedClipSource() {
+    }
+
+    /**
+     * @brief Read the next bytes
+     *
+     * @param dst - Buffer
+     * @param n - Nbr of bytes to read
+     * @return uint8_t - Nbr of bytes read, less at the end of the clip
+     */
+    virtual uint8_t read(uint8_t *dst, uint8_t n) = 0;
+
+    /**
+     * @brief Continue reading at an offset from the start of the clip
+     */
+    virtual void seek(uint16_t offset) = 0;
+};
+
+/**
+ * @brief Clip in flash, e.g. one of PLedClips.h
+ */
+class PLedFlashClip : public PLedClipSource {
+   public:
+    PLedFlashClip(const uint8_t *data, uint16_t size) : data(data), size(size) {
+    }
+
+    uint8_t read(uint8_t *dst, uint8_t n) override;
+    void seek(uint16_t offset) override;
+
+   private:
+    const uint8_t *data;
+    uint16_t size;
+    uint16_t pos = 0;
+};
+
+#ifdef BUILD_FOR_ESP32
+/**
+ * @brief Clip in a file, e.g. on LittleFS
+ */
+class PLedFileClip : public PLedClipSource {
+   public:
+    explicit PLedFileClip(fs::File file) : file(file) {
+    }
+
+    uint8_t read(uint8_t *dst, uint8_t n) override {
+        return file.read(dst, n);
+    }
+    void seek(uint16_t offset) override {
+        file.seek(offset);
+    }
+
+   private:
+    fs::File file;
+};
+#endif
+
+class PLedClipPlayer {
+   public:
+    static const uint8_t FORMAT_VERSION = 1;
+    static const uint8_t HEADER_SIZE = 7;  // 'P' 'L' 'C' version flags frameCount(2)
+    static const uint8_t FLAG_LOOP = 0x01;
+    static const uint8_t OFF_RUN = 0x80;   // Run turns the LED's off
+    static const uint8_t RUN_LENGTH = 0x7F;
+
+    /**
+     * @brief Start a clip from its first keyframe
+     *
+     * @param clip - Source of the clip, must stay valid while playing
+     * @return true - Clip is playing
+     * @return false - No clip of this format version
+     */
+    bool begin(PLedClipSource *clip);
+
+    inline void stop() {
+        source = nullptr;
+    }
+
+    inline bool isPlaying() const {
+        return source != nullptr;
+    }
+
+    /**
+     * @brief Advance by one animation step, draws the next keyframe when it is due
+     *
+     * Keyframes are drawn on top of the content of the layer, the first one on a cleared layer.
+     * A clip without loop stops after its last keyframe and keeps showing it.
+     *
+     * @param layer - Layer the clip is drawn on
+     * @return true - Layer changed
+     */
+    bool step(PLedLayer &layer);
+
+   private:
+    PLedClipSource *source = nullptr;
+    uint16_t frameCount = 0;
+    uint16_t frame = 0;  // Next keyframe
+    uint8_t hold = 0;    // Steps the current keyframe is still shown
+    bool loop = false;
+};
@@ -0,0 +1,121 @@
+// Animation clips converted by tools/clipc.py from clips/, do not edit.
+#pragma once
+
+#include "PLedGeometry.h"
+
+// sunrise.clip
+inline constexpr uint8_t CLIP_SUNRISE[1801] PLED_FLASH = {
+    0x50, 0x4C, 0x43, 0x01, 0x01, 0x0F, 0x00, 0x04, 0x09, 0x06, 0x01, 0x40, 0x08, 0x00, 0x0C, 0x02,
+    0x40, 0x08, 0x00, 0x0C, 0x02, 0x40, 0x08, 0x00, 0x0C, 0x02, 0x40, 0x08, 0x00, 0x0C, 0x02, 0x40,
+    0x08, 0x00, 0x0C, 0x02, 0x40, 0x08, 0x00, 0x0C, 0x02, 0x40, 0x08, 0x00, 0x0C, 0x02, 0x40, 0x08,
+    0x00, 0x0C, 0x02, 0x40, 0x08, 0x00, 0x04, 0x1B, 0x05, 0x01, 0x40, 0x08, 0x00, 0x00, 0x01, 0x80,
+    0x20, 0x00, 0x00, 0x01, 0x40, 0x08, 0x00, 0x0A, 0x01, 0x40, 0x08, 0x00, 0x00, 0x02, 0x80, 0x20,
+    0x00, 0x00, 0x01, 0x40, 0x08, 0x00, 0x0A, 0x01, 0x40, 0x08, 0x00, 0x00, 0x02, 0x80, 0x20, 0x00,
+    0x00, 0x01, 0x40, 0x08, 0x00, 0x0A, 0x01, 0x40, 0x08, 0x00, 0x00, 0x02, 0x80, 0x20, 0x00, 0x00,
+    0x01, 0x40, 0x08, 0x00, 0x0A, 0x01, 0x40, 0x08, 0x00, 0x00, 0x02, 0x80, 0x20, 0x00, 0x00, 0x01,
+    0x40, 0x08, 0x00, 0x0A, 0x01, 0x40, 0x08, 0x00, 0x00, 0x02, 0x80, 0x20, 0x00, 0x00, 0x01, 0x40,
+    0x08, 0x00, 0x0A, 0x01, 0x40, 0x08, 0x00, 0x00, 0x02, 0x80, 0x20, 0x00, 0x00, 0x01, 0x40, 0x08,
+    0x00, 0x0A, 0x01, 0x40, 0x08, 0x00, 0x00, 0x02, 0x80, 0x20, 0x00, 0x00, 0x01, 0x40, 0x08, 0x00,
+    0x0A, 0x01, 0x40, 0x08, 0x00, 0x00, 0x02, 0x80, 0x20, 0x00, 0x00, 0x01, 0x40, 0x08, 0x00, 0x04,
+    0x2E, 0x04, 0x01, 0x40, 0x08, 0x00, 0x00, 0x01, 0x80, 0x20, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x00,
+    0x00, 0x01, 0x80, 0x20, 0x00, 0x00, 0x01, 0x40, 0x08, 0x00, 0x08, 0x01, 0x40, 0x08, 0x00, 0x00,
+    0x01, 0x80, 0x20, 0x00, 0x00, 0x02, 0xC0, 0x40, 0x00, 0x00, 0x01, 0x80, 0x20, 0x00, 0x00, 0x01,
+    0x40, 0x08, 0x00, 0x08, 0x01, 0x40, 0x08, 0x00, 0x00, 0x01, 0x80, 0x20, 0x00, 0x00, 0x02, 0xC0,
+    0x40, 0x00, 0x00, 0x01, 0x80, 0x20, 0x00, 0x00, 0x01, 0x40, 0x08, 0x00, 0x08, 0x01, 0x40, 0x08,
+    0x00, 0x00, 0x01, 0x80, 0x20, 0x00, 0x00, 0x02, 0xC0, 0x40, 0x00, 0x00, 0x01, 0x80, 0x20, 0x00,
+    0x00, 0x01, 0x40, 0x08, 0x00, 0x08, 0x01, 0x40, 0x08, 0x00, 0x00, 0x01, 0x80, 0x20, 0x00, 0x00,
+    0x02, 0xC0, 0x40, 0x00, 0x00, 0x01, 0x80, 0x20, 0x00, 0x00, 0x01, 0x40, 0x08, 0x00, 0x08, 0x01,
+    0x40, 0x08, 0x00, 0x00, 0x01, 0x80, 0x20, 0x00, 0x00, 0x02, 0xC0, 0x40, 0x00, 0x00, 0x01, 0x80,
+    0x20, 0x00, 0x00, 0x01, 0x40, 0x08, 0x00, 0x08, 0x01, 0x40, 0x08, 0x00, 0x00, 0x01, 0x80, 0x20,
+    0x00, 0x00, 0x02, 0xC0, 0x40, 0x00, 0x00, 0x01, 0x80, 0x20, 0x00, 0x00, 0x01, 0x40, 0x08, 0x00,
+    0x08, 0x01, 0x40, 0x08, 0x00, 0x00, 0x01, 0x80, 0x20, 0x00, 0x00, 0x02, 0xC0, 0x40, 0x00, 0x00,
+    0x01, 0x80, 0x20, 0x00, 0x00, 0x01, 0x40, 0x08, 0x00, 0x08, 0x01, 0x40, 0x08, 0x00, 0x00, 0x01,
+    0x80, 0x20, 0x00, 0x00, 0x02, 0xC0, 0x40, 0x00, 0x00, 0x01, 0x80, 0x20, 0x00, 0x00, 0x01, 0x40,
+    0x08, 0x00, 0x06, 0x01, 0x40, 0x08, 0x00, 0x04, 0x42, 0x00, 0x01, 0x20, 0x08, 0x30, 0x02, 0x01,
+    0x20, 0x08, 0x30, 0x00, 0x01, 0x80, 0x20, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x00, 0x00, 0x01, 0xFF,
+    0x60, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x00, 0x00, 0x01, 0x80, 0x20, 0x00, 0x00, 0x01, 0x20, 0x08,
+    0x30, 0x06, 0x01, 0x20, 0x08, 0x30, 0x00, 0x01, 0x80, 0x20, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x00,
+    0x00, 0x02, 0xFF, 0x60, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x00, 0x00, 0x01, 0x80, 0x20, 0x00, 0x00,
+    0x01, 0x20, 0x08, 0x30, 0x06, 0x01, 0x20, 0x08, 0x30, 0x00, 0x01, 0x80, 0x20, 0x00, 0x00, 0x01,
+    0xC0, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x60, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x00, 0x00, 0x01, 0x80,
+    0x20, 0x00, 0x00, 0x01, 0x20, 0x08, 0x30, 0x06, 0x01, 0x20, 0x08, 0x30, 0x00, 0x01, 0x80, 0x20,
+    0x00, 0x00, 0x01, 0xC0, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x60, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x00,
+    0x00, 0x01, 0x80, 0x20, 0x00, 0x00, 0x01, 0x20, 0x08, 0x30, 0x06, 0x01, 0x20, 0x08, 0x30, 0x00,
+    0x01, 0x80, 0x20, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x60, 0x00, 0x00, 0x01,
+    0xC0, 0x40, 0x00, 0x00, 0x01, 0x80, 0x20, 0x00, 0x00, 0x01, 0x20, 0x08, 0x30, 0x06, 0x01, 0x20,
+    0x08, 0x30, 0x00, 0x01, 0x80, 0x20, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x60,
+    0x00, 0x00, 0x01, 0xC0, 0x40, 0x00, 0x00, 0x01, 0x80, 0x20, 0x00, 0x00, 0x01, 0x20, 0x08, 0x30,
+    0x06, 0x01, 0x20, 0x08, 0x30, 0x00, 0x01, 0x80, 0x20, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x00, 0x00,
+    0x02, 0xFF, 0x60, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x00, 0x00, 0x01, 0x80, 0x20, 0x00, 0x00, 0x01,
+    0x20, 0x08, 0x30, 0x06, 0x01, 0x20, 0x08, 0x30, 0x00, 0x01, 0x80, 0x20, 0x00, 0x00, 0x01, 0xC0,
+    0x40, 0x00, 0x00, 0x02, 0xFF, 0x60, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x00, 0x00, 0x01, 0x80, 0x20,
+    0x00, 0x00, 0x01, 0x20, 0x08, 0x30, 0x06, 0x01, 0x20, 0x08, 0x30, 0x00, 0x01, 0x80, 0x20, 0x00,
+    0x00, 0x01, 0xC0, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x60, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x00, 0x00,
+    0x01, 0x80, 0x20, 0x00, 0x00, 0x01, 0x20, 0x08, 0x30, 0x04, 0x01, 0x20, 0x08, 0x30, 0x00, 0x01,
+    0x80, 0x20, 0x00, 0x04, 0x4C, 0x00, 0x01, 0x40, 0x10, 0x40, 0x01, 0x01, 0x20, 0x08, 0x30, 0x00,
+    0x01, 0x40, 0x10, 0x40, 0x00, 0x01, 0xC0, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x60, 0x00, 0x01, 0x01,
+    0xFF, 0x60, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x00, 0x00, 0x01, 0x40, 0x10, 0x40, 0x00, 0x01, 0x20,
+    0x08, 0x30, 0x04, 0x01, 0x20, 0x08, 0x30, 0x00, 0x01, 0x40, 0x10, 0x40, 0x00, 0x01, 0xC0, 0x40,
+    0x00, 0x00, 0x01, 0xFF, 0x60, 0x00, 0x02, 0x01, 0xFF, 0x60, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x00,
+    0x00, 0x01, 0x40, 0x10, 0x40, 0x00, 0x01, 0x20, 0x08, 0x30, 0x04, 0x01, 0x20, 0x08, 0x30, 0x00,
+    0x01, 0x40, 0x10, 0x40, 0x00, 0x01, 0xC0, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x60, 0x00, 0x02, 0x01,
+    0xFF, 0x60, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x00, 0x00, 0x01, 0x40, 0x10, 0x40, 0x00, 0x01, 0x20,
+    0x08, 0x30, 0x04, 0x01, 0x20, 0x08, 0x30, 0x00, 0x01, 0x40, 0x10, 0x40, 0x00, 0x01, 0xC0, 0x40,
+    0x00, 0x00, 0x01, 0xFF, 0x60, 0x00, 0x02, 0x01, 0xFF, 0x60, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x00,
+    0x00, 0x01, 0x40, 0x10, 0x40, 0x00, 0x01, 0x20, 0x08, 0x30, 0x04, 0x01, 0x20, 0x08, 0x30, 0x00,
+    0x01, 0x40, 0x10, 0x40, 0x00, 0x01, 0xC0, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x60, 0x00, 0x02, 0x01,
+    0xFF, 0x60, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x00, 0x00, 0x01, 0x40, 0x10, 0x40, 0x00, 0x01, 0x20,
+    0x08, 0x30, 0x04, 0x01, 0x20, 0x08, 0x30, 0x00, 0x01, 0x40, 0x10, 0x40, 0x00, 0x01, 0xC0, 0x40,
+    0x00, 0x00, 0x01, 0xFF, 0x60, 0x00, 0x02, 0x01, 0xFF, 0x60, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x00,
+    0x00, 0x01, 0x40, 0x10, 0x40, 0x00, 0x01, 0x20, 0x08, 0x30, 0x04, 0x01, 0x20, 0x08, 0x30, 0x00,
+    0x01, 0x40, 0x10, 0x40, 0x00, 0x01, 0xC0, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x60, 0x00, 0x02, 0x01,
+    0xFF, 0x60, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x00, 0x00, 0x01, 0x40, 0x10, 0x40, 0x00, 0x01, 0x20,
+    0x08, 0x30, 0x04, 0x01, 0x20, 0x08, 0x30, 0x00, 0x01, 0x40, 0x10, 0x40, 0x00, 0x01, 0xC0, 0x40,
+    0x00, 0x00, 0x01, 0xFF, 0x60, 0x00, 0x02, 0x01, 0xFF, 0x60, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x00,
+    0x00, 0x01, 0x40, 0x10, 0x40, 0x00, 0x01, 0x20, 0x08, 0x30, 0x04, 0x01, 0x20, 0x08, 0x30, 0x00,
+    0x01, 0x40, 0x10, 0x40, 0x00, 0x01, 0xC0, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x60, 0x00, 0x02, 0x01,
+    0xFF, 0x60, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x00, 0x00, 0x01, 0x40, 0x10, 0x40, 0x00, 0x01, 0x20,
+    0x08, 0x30, 0x02, 0x01, 0x20, 0x08, 0x30, 0x00, 0x01, 0x40, 0x10, 0x40, 0x00, 0x01, 0xC0, 0x40,
+    0x00, 0x04, 0x28, 0x01, 0x01, 0x20, 0x08, 0x30, 0x00, 0x01, 0x40, 0x20, 0x50, 0x07, 0x01, 0x40,
+    0x20, 0x50, 0x00, 0x01, 0x20, 0x08, 0x30, 0x02, 0x01, 0x20, 0x08, 0x30, 0x00, 0x01, 0x40, 0x20,
+    0x50, 0x08, 0x01, 0x40, 0x20, 0x50, 0x00, 0x01, 0x20, 0x08, 0x30, 0x02, 0x01, 0x20, 0x08, 0x30,
+    0x00, 0x01, 0x40, 0x20, 0x50, 0x08, 0x01, 0x40, 0x20, 0x50, 0x00, 0x01, 0x20, 0x08, 0x30, 0x02,
+    0x01, 0x20, 0x08, 0x30, 0x00, 0x01, 0x40, 0x20, 0x50, 0x08, 0x01, 0x40, 0x20, 0x50, 0x00, 0x01,
+    0x20, 0x08, 0x30, 0x02, 0x01, 0x20, 0x08, 0x30, 0x00, 0x01, 0x40, 0x20, 0x50, 0x02, 0x01, 0xFF,
+    0xD0, 0x40, 0x02, 0x02, 0xFF, 0xD0, 0x40, 0x01, 0x01, 0x40, 0x20, 0x50, 0x00, 0x01, 0x20, 0x08,
+    0x30, 0x02, 0x01, 0x20, 0x08, 0x30, 0x00, 0x01, 0x40, 0x20, 0x50, 0x01, 0x02, 0xFF, 0xD0, 0x40,
+    0x05, 0x01, 0x40, 0x20, 0x50, 0x00, 0x01, 0x20, 0x08, 0x30, 0x02, 0x01, 0x20, 0x08, 0x30, 0x00,
+    0x01, 0x40, 0x20, 0x50, 0x08, 0x01, 0x40, 0x20, 0x50, 0x00, 0x01, 0x20, 0x08, 0x30, 0x02, 0x01,
+    0x20, 0x08, 0x30, 0x00, 0x01, 0x40, 0x20, 0x50, 0x08, 0x01, 0x40, 0x20, 0x50, 0x00, 0x01, 0x20,
+    0x08, 0x30, 0x02, 0x01, 0x20, 0x08, 0x30, 0x00, 0x01, 0x40, 0x20, 0x50, 0x08, 0x01, 0x40, 0x20,
+    0x50, 0x00, 0x01, 0x20, 0x08, 0x30, 0x01, 0x01, 0x40, 0x20, 0x50, 0x04, 0x1F, 0x01, 0x01, 0x40,
+    0x20, 0x50, 0x09, 0x01, 0x40, 0x20, 0x50, 0x00, 0x02, 0x30, 0x10, 0x40, 0x00, 0x01, 0x40, 0x20,
+    0x50, 0x0A, 0x01, 0x40, 0x20, 0x50, 0x00, 0x02, 0x30, 0x10, 0x40, 0x00, 0x01, 0x40, 0x20, 0x50,
+    0x0A, 0x01, 0x40, 0x20, 0x50, 0x00, 0x02, 0x30, 0x10, 0x40, 0x00, 0x01, 0x40, 0x20, 0x50, 0x08,
+    0x01, 0xFF, 0xD0, 0x40, 0x01, 0x01, 0x40, 0x20, 0x50, 0x00, 0x02, 0x30, 0x10, 0x40, 0x00, 0x01,
+    0x40, 0x20, 0x50, 0x01, 0x02, 0xFF, 0xE0, 0x80, 0x05, 0x01, 0xFF, 0xE0, 0x80, 0x01, 0x01, 0x40,
+    0x20, 0x50, 0x00, 0x02, 0x30, 0x10, 0x40, 0x00, 0x01, 0x40, 0x20, 0x50, 0x07, 0x01, 0xFF, 0xD0,
+    0x40, 0x02, 0x01, 0x40, 0x20, 0x50, 0x00, 0x02, 0x30, 0x10, 0x40, 0x00, 0x01, 0x40, 0x20, 0x50,
+    0x0A, 0x01, 0x40, 0x20, 0x50, 0x00, 0x02, 0x30, 0x10, 0x40, 0x00, 0x01, 0x40, 0x20, 0x50, 0x0A,
+    0x01, 0x40, 0x20, 0x50, 0x00, 0x02, 0x30, 0x10, 0x40, 0x00, 0x01, 0x40, 0x20, 0x50, 0x0A, 0x01,
+    0x40, 0x20, 0x50, 0x00, 0x01, 0x30, 0x10, 0x40, 0x28, 0x0D, 0x0C, 0x02, 0x20, 0x30, 0x60, 0x0C,
+    0x02, 0x20, 0x30, 0x60, 0x0C, 0x02, 0x20, 0x30, 0x60, 0x02, 0x01, 0xFF, 0xD0, 0x40, 0x09, 0x02,
+    0x20, 0x30, 0x60, 0x01, 0x01, 0xFF, 0xD0, 0x40, 0x08, 0x01, 0xFF, 0xD0, 0x40, 0x01, 0x02, 0x20,
+    0x30, 0x60, 0x02, 0x01, 0xFF, 0xD0, 0x40, 0x09, 0x02, 0x20, 0x30, 0x60, 0x0C, 0x02, 0x20, 0x30,
+    0x60, 0x0C, 0x02, 0x20, 0x30, 0x60, 0x0C, 0x01, 0x20, 0x30, 0x60, 0x03, 0x09, 0x0C, 0x82, 0x0C,
+    0x82, 0x0C, 0x82, 0x0C, 0x82, 0x0C, 0x82, 0x0C, 0x82, 0x0C, 0x82, 0x0C, 0x82, 0x0C, 0x81, 0x03,
+    0x12, 0x01, 0x81, 0x09, 0x81, 0x02, 0x81, 0x0A, 0x81, 0x02, 0x81, 0x0A, 0x81, 0x02, 0x81, 0x0A,
+    0x81, 0x02, 0x81, 0x0A, 0x81, 0x02, 0x81, 0x0A, 0x81, 0x02, 0x81, 0x0A, 0x81, 0x02, 0x81, 0x0A,
+    0x81, 0x02, 0x81, 0x0A, 0x81, 0x03, 0x13, 0x02, 0x81, 0x07, 0x81, 0x04, 0x81, 0x08, 0x81, 0x04,
+    0x81, 0x08, 0x81, 0x04, 0x81, 0x08, 0x81, 0x04, 0x81, 0x08, 0x81, 0x04, 0x81, 0x08, 0x81, 0x04,
+    0x81, 0x08, 0x81, 0x04, 0x81, 0x08, 0x81, 0x04, 0x81, 0x08, 0x81, 0x02, 0x81, 0x03, 0x14, 0x00,
+    0x81, 0x02, 0x81, 0x05, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06,
+    0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06,
+    0x81, 0x06, 0x81, 0x06, 0x81, 0x04, 0x81, 0x03, 0x13, 0x04, 0x81, 0x03, 0x81, 0x08, 0x81, 0x04,
+    0x81, 0x08, 0x81, 0x04, 0x81, 0x08, 0x81, 0x04, 0x81, 0x08, 0x81, 0x04, 0x81, 0x08, 0x81, 0x04,
+    0x81, 0x08, 0x81, 0x04, 0x81, 0x08, 0x81, 0x04, 0x81, 0x08, 0x81, 0x04, 0x81, 0x06, 0x81, 0x03,
+    0x12, 0x05, 0x81, 0x01, 0x81, 0x0A, 0x81, 0x02, 0x81, 0x0A, 0x81, 0x02, 0x81, 0x0A, 0x81, 0x02,
+    0x81, 0x0A, 0x81, 0x02, 0x81, 0x0A, 0x81, 0x02, 0x81, 0x0A, 0x81, 0x02, 0x81, 0x0A, 0x81, 0x02,
+    0x81, 0x0A, 0x81, 0x02, 0x81, 0x0A, 0x09, 0x06, 0x81, 0x0C, 0x82, 0x0C, 0x82, 0x0C, 0x82, 0x0C,
+    0x82, 0x0C, 0x82, 0x0C, 0x82, 0x0C, 0x82, 0x0C, 0x82,
+};
@@ -0,0 +1,40 @@
+/**
+ * @file PLedClock.cpp
+ * @date 2026-10-15
+ *
+ */
+
+#include "PLedClock.h"
+
+PLedClock::PLedClock(uint16_t stepMs, uint16_t framePeriodMs) : stepMs(stepMs), framePeriodMs(framePeriodMs) {
+}
+
+uint8_t PLedClock::tick(unsigned long nowMs) {
+    if (!started) {
+        // Animation time starts with the first frame, which shows the first step
+        started = true;
+        lastTickMs = nowMs;
+        stats.rendered++;
+        steps++;
+        return 1;
+    }
+
+    unsigned long elapsedMs = nowMs - lastTickMs;
+    lastTickMs = nowMs;
+
+    stats.rendered++;
+    if (elapsedMs > framePeriodMs + framePeriodMs / 2) {
+        stats.late++;
+        stats.dropped += (elapsedMs + framePeriodMs / 2) / framePeriodMs - 1;
+    }
+
+    unsigned long pendingMs = accumulatorMs + elapsedMs;
+    unsigned long pendingSteps = pendingMs / stepMs;
+    if (pendingSteps > MAX_CATCH_UP_STEPS) {
+        pendingSteps = MAX_CATCH_UP_STEPS;
+        pendingMs = pendingSteps * stepMs;
+    }
+    accumulatorMs = pendingMs - pendingSteps * stepMs;
+    steps += pendingSteps;
+    return pendingSteps;
+}
@@ -0,0 +1,96 @@
+/**
+ * @file PLedClock.h
+ * @brief Fixed-timestep animation clock with frame accounting
+ *
+ * Animations advance in fixed steps of the elapsed time, independent of how often the display
+ * is refreshed: at 10 Hz every frame runs two steps, at 60 Hz most frames run none. Effects
+ * therefore move at the same speed for any refresh rate and jitter of the render task.
+ * Each tick is compared to the expected frame period to count late and dropped frames.
+ *
+ * @date 2026-10-15
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+class PLedClock {
+   public:
+    /**
+     * @brief Counters of display frames
+     */
+    struct Stats {
+        uint32_t rendered = 0;  // Frames ticked
+        uint32_t late = 0;      // Frames more than half a frame period late
+        uint32_t dropped = 0;   // Frame periods passed without any frame
+    };
+
+    static const uint8_t MAX_CATCH_UP_STEPS = 8;  // Steps run at most per frame, older time is discarded
+
+    /**
+     * @brief Construct a new PLedClock object
+     *
+     * @param stepMs - Duration of one animation step [ms]
+     * @param framePeriodMs - Expected time between two display frames [ms]
+     */
+    PLedClock(uint16_t stepMs, uint16_t framePeriodMs);
+
+    /**
+     * @brief Account a display frame and advance the animation time
+     *
+     * @param nowMs - Current time e.g. millis()
+     * @return uint8_t - Nbr of animation steps to run for this frame
+     */
+    uint8_t tick(unsigned long nowMs);
+
+    /**
+     * @brief Set the expected time between two display frames
+     *
+     * @param framePeriodMs - Frame period [ms]
+     */
+    inline void setFramePeriod(uint16_t framePeriodMs) {
+        this->framePeriodMs = framePeriodMs;
+    }
+
+    /**
+     * @brief Total nbr of animation steps run
+     */
+    inline uint32_t getSteps() const {
+        return steps;
+    }
+
+    /**
+     * @brief Progress of the current, not yet completed step
+     *
+     * @return uint8_t - 0--255 for 0--100% of a step
+     */
+    inline uint8_t getStepFraction() const {
+        return (uint32_t(accumulatorMs) * 256) / stepMs;
+    }
+
+    /**
+     * @brief Animation time, the sum of all steps run and the fraction of the current one
+     *
+     * @return uint32_t - Time [ms]
+     */
+    inline uint32_t getTimeMs() const {
+        return steps * stepMs + accumulatorMs;
+    }
+
+    inline uint16_t getStepMs() const {
+        return stepMs;
+    }
+
+    inline Stats getStats() const {
+        return stats;
+    }
+
+   private:
+    uint16_t stepMs;
+    uint16_t framePeriodMs;
+    uint16_t accumulatorMs = 0;  ///< Time not yet consumed by a step
+    uint32_t steps = 0;
+    unsigned long lastTickMs = 0;
+    bool started = false;
+    Stats stats;
+};
@@ -0,0 +1,21 @@
+/**
+ * @file PLedColorRamp.cpp
+ * @date 2026-10-15
+ *
+ */
+
+#include "PLedColorRamp.h"
+
+void PLedColorRamp::set(uint8_t sat, uint8_t val) {
+    if (valid && (sat == this->sat) && (val == this->val)) {
+        return;
+    }
+    this->sat = sat;
+    this->val = val;
+    valid = true;
+#ifdef PLED_COLOR_RAMP_CACHE
+    for (int hue = 0; hue < 256; hue++) {
+        table[hue] = CHSV(hue, sat, val);
+    }
+#endif
+}
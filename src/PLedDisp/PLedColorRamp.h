@@ -0,0 +1,51 @@
+/**
+ * @file PLedColorRamp.h
+ * @brief Colour ramp of the rainbow effects: the colour of every hue at one saturation and value
+ *
+ * The rainbow effects colour each LED with CHSV(hue, sat, val), only the hue changes from LED
+ * to LED. The ramp keeps the 256 converted colours and is only rebuilt when saturation or value
+ * change, so a pixel is a table load instead of a HSV to RGB conversion.
+ * The Nano has no RAM for the 768 byte table and converts on the fly.
+ *
+ * @date 2026-10-15
+ */
+
+#pragma once
+
+#include <FastLED.h>
+
+#ifndef BUILD_FOR_NANO
+#define PLED_COLOR_RAMP_CACHE
+#endif
+
+class PLedColorRamp {
+   public:
+    /**
+     * @brief Set saturation and value of the ramp, the table is only rebuilt if they changed
+     *
+     * @param sat - Saturation 0--255
+     * @param val - Value 0--255
+     */
+    void set(uint8_t sat, uint8_t val);
+
+    /**
+     * @brief Colour of a hue
+     *
+     * @param hue - Hue 0--255
+     */
+    inline CRGB at(uint8_t hue) const {
+#ifdef PLED_COLOR_RAMP_CACHE
+        return table[hue];
+#else
+        return CHSV(hue, sat, val);
+#endif
+    }
+
+   private:
+    uint8_t sat = 0;
+    uint8_t val = 0;
+    bool valid = false;
+#ifdef PLED_COLOR_RAMP_CACHE
+    CRGB table[256];
+#endif
+};
@@ -0,0 +1,172 @@
+/**
+ * @file PLedCompositor.cpp
+ * @date 2026-10-15
+ *
+ */
+
+#include "PLedCompositor.h"
+
+#include <string.h>
+
+#ifdef PLED_INDEXED_COLOR
+uint8_t PLedLayer::nearest(const CRGB &color) {
+    // Layers mostly draw runs of the same colour
+    if (color == lastColor) {
+        return lastIndex;
+    }
+    uint16_t best = 0xFFFF;
+    for (uint8_t entry = 0; entry < 16; entry++) {
+        const CRGB &c = palette[entry];
+        uint16_t distance = abs(int(c.r) - color.r) + abs(int(c.g) - color.g) + abs(int(c.b) - color.b);
+        if (distance < best) {
+            best = distance;
+            lastIndex = entry << 4;
+        }
+    }
+    lastColor = color;
+    return lastIndex;
+}
+#endif
+
+/**
+ * @brief Merge a pixel of a layer onto the colour below
+ */
+static inline CRGB blendPixel(const CRGB &below, const PLedLayer &layer, uint8_t i) {
+#ifdef PLED_INDEXED_COLOR
+    const CRGB px = ColorFromPalette(layer.palette, layer.px[i]);
+#else
+    const CRGB &px = layer.px[i];
+#endif
+    switch (layer.blend) {
+        case BlendMode::Add:
+            return CRGB(qadd8(below.r, scale8(px.r, layer.alpha)),
+                        qadd8(below.g, scale8(px.g, layer.alpha)),
+                        qadd8(below.b, scale8(px.b, layer.alpha)));
+        case BlendMode::Alpha:
+            return CRGB(scale8(below.r, 255 - layer.alpha) + scale8(px.r, layer.alpha),
+                        scale8(below.g, 255 - layer.alpha) + scale8(px.g, layer.alpha),
+                        scale8(below.b, 255 - layer.alpha) + scale8(px.b, layer.alpha));
+        default:
+            return px;
+    }
+}
+
+/**
+ * @brief Merge a pixel of a layer onto the colour below, with its coverage if it is partial
+ */
+static inline CRGB coverPixel(const CRGB &below, const PLedLayer &layer, uint8_t i, bool partial) {
+#ifdef PLED_COVERAGE
+    if (partial) {
+        return blend(below, blendPixel(below, layer, i), layer.coverage[i]);
+    }
+#endif
+    return blendPixel(below, layer, i);
+}
+
+bool PLedCompositor::isDirty() const {
+    for (uint8_t l = 0; l < BufferCount; l++) {
+        if (layers[l].dirty) {
+            return true;
+        }
+#ifdef PLED_CROSSFADE
+        if (fades[l].length != 0) {
+            return true;
+        }
+#endif
+    }
+    return false;
+}
+
+#ifdef PLED_CROSSFADE
+void PLedCompositor::updateFades(uint8_t steps) {
+    for (uint8_t l = 0; l < BufferCount; l++) {
+        Fade &fade = fades[l];
+        if (fade.requested != 0) {
+            fade.from = layers[l];
+            fade.length = fade.requested;
+            fade.requested = 0;
+            fade.elapsed = 0;
+            fade.weight = 0;
+            memset(fade.lerp, 0, sizeof(fade.lerp));
+            continue;
+        }
+        if (fade.length == 0) {
+            continue;
+        }
+        fade.elapsed += steps;
+        if (fade.elapsed >= fade.length) {
+            fade.length = 0;  // Done, the next composition shows only the new content
+            layers[l].dirty = true;
+            continue;
+        }
+        uint8_t weight = ((uint32_t)fade.elapsed << 8) / fade.length;
+        if (weight != fade.weight) {
+            fade.weight = weight;
+            for (uint16_t v = 0; v < 256; v++) {
+                fade.lerp[v] = (v * weight) >> 8;
+            }
+        }
+    }
+}
+#endif
+
+void PLedCompositor::compose(CRGB *out, uint8_t nLeds) {
+    for (uint8_t k = 0; (k < LedMask::WORDS) && (k * 32 < nLeds); k++) {
+        uint32_t words[BufferCount];
+        uint32_t partialWords[BufferCount] = {};
+        uint32_t covered = 0;
+        for (uint8_t l = 0; l < BufferCount; l++) {
+            words[l] = layers[l].mask.w[k];
+            covered |= words[l];
+#ifdef PLED_COVERAGE
+            partialWords[l] = layers[l].partial.w[k];
+#endif
+        }
+#ifdef PLED_CROSSFADE
+        uint32_t fadeWords[BufferCount];
+        uint32_t fadePartialWords[BufferCount] = {};
+        for (uint8_t l = 0; l < BufferCount; l++) {
+            fadeWords[l] = (fades[l].length != 0) ? fades[l].from.mask.w[k] : 0;
+            covered |= fadeWords[l];
+#ifdef PLED_COVERAGE
+            fadePartialWords[l] = (fades[l].length != 0) ? fades[l].from.partial.w[k] : 0;
+#endif
+        }
+#endif
+
+        uint8_t end = (nLeds - k * 32 < 32) ? (nLeds - k * 32) : 32;
+        for (uint8_t b = 0; b < end; b++) {
+            uint8_t i = k * 32 + b;
+            CRGB color = CRGB::Black;
+            uint32_t bit = 1UL << b;
+            if (covered & bit) {
+                for (uint8_t l = 0; l < BufferCount; l++) {
+#ifdef PLED_CROSSFADE
+                    if (fades[l].length != 0) {
+                        if (((words[l] | fadeWords[l]) & bit) == 0) {
+                            continue;
+                        }
+                        // Both contents on the same colour below: old - old * w + new * w
+                        const uint8_t *lerp = fades[l].lerp;
+                        CRGB from = (fadeWords[l] & bit) ? coverPixel(color, fades[l].from, i, fadePartialWords[l] & bit) : color;
+                        CRGB to = (words[l] & bit) ? coverPixel(color, layers[l], i, partialWords[l] & bit) : color;
+                        color.r = from.r - lerp[from.r] + lerp[to.r];
+                        color.g = from.g - lerp[from.g] + lerp[to.g];
+                        color.b = from.b - lerp[from.b] + lerp[to.b];
+                        continue;
+                    }
+#endif
+                    if ((words[l] & bit) == 0) {
+                        continue;
+                    }
+                    color = coverPixel(color, layers[l], i, partialWords[l] & bit);
+                }
+            }
+            out[i] = color;
+        }
+    }
+
+    for (uint8_t l = 0; l < BufferCount; l++) {
+        layers[l].dirty = false;
+    }
+}
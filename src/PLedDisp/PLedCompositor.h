@@ -0,0 +1,300 @@
+/**
+ * @file PLedCompositor.h
+ * @brief Layers of the PingPong display and the compositor merging them into the LED buffer
+ *
+ * Every layer has its own pixel buffer and a coverage mask. Only covered LEDs take part in
+ * the blending, uncovered LEDs are transparent. A layer keeps its content between frames and
+ * is only rasterised again when its inputs change.
+ *
+ * With PLED_INDEXED_COLOR (default on the Nano) a layer holds 8 bit indices into its own 16 entry
+ * palette instead of RGB colours, a third of the RAM. The palette is expanded to RGB in the
+ * composition pass, so swapping a palette recolours the layer without rasterising it again.
+ *
+ * With PLED_CROSSFADE (not on the Nano) a layer can fade from its content at the start of the
+ * fade to its new content. The old content is kept as a copy and blended in the composition pass
+ * with an 8 bit lerp table per layer, the layers themselves are rasterised as always.
+ *
+ * With PLED_COVERAGE (not on the Nano) single LED's of a layer can be drawn partly covering the
+ * layers below, e.g. the LED's of a digit fading in. Only the LED's in the partial mask are
+ * blended with their coverage, the others cost one more bit test.
+ *
+ * With PLED_DIRECT_LAYERS (default on the Nano) only the background and the foreground have
+ * buffers. The frame and the overlay are drawn by the caller straight into the LED buffer after
+ * compose(), as the display did before the layers, so the Nano keeps its RAM for the stack.
+ *
+ * @date 2026-10-15
+ */
+
+#pragma once
+
+#include <FastLED.h>
+
+#include "LedMask.h"
+
+#if defined(BUILD_FOR_NANO) && !defined(PLED_DIRECT_LAYERS)
+#define PLED_DIRECT_LAYERS  // No buffers for the frame and overlay, 2 layers less RAM
+#endif
+
+#if defined(BUILD_FOR_NANO) && !defined(PLED_INDEXED_COLOR)
+#define PLED_INDEXED_COLOR  // 1 instead of 3 bytes per LED and layer
+#endif
+
+#if !defined(BUILD_FOR_NANO) && !defined(PLED_CROSSFADE)
+#define PLED_CROSSFADE  // Copy of the old content per layer, 0.7 kB RAM each
+#endif
+
+#if !defined(BUILD_FOR_NANO) && !defined(PLED_COVERAGE)
+#define PLED_COVERAGE  // Coverage per LED, 129 bytes per layer
+#endif
+
+#ifdef PLED_INDEXED_COLOR
+typedef uint8_t PLedPixel;  // Index into the palette of the layer, 0--255 blends between the 16 entries
+#else
+typedef CRGB PLedPixel;
+#endif
+
+enum class BlendMode : uint8_t { Replace,  // Layer colour replaces what is below
+                                 Add,      // Layer colour (scaled by alpha) is added, saturating
+                                 Alpha     // Layer colour is mixed with what is below by alpha
+};
+
+struct PLedLayer {
+    PLedPixel px[LedMask::BITS + 1];       // Colour of covered LED's, the last one is the sink for missing LED's
+    LedMask mask;                          // Coverage of the layer
+    BlendMode blend = BlendMode::Replace;  // How the layer is merged onto the layers below
+    uint8_t alpha = 255;                   // Opacity for BlendMode::Add and BlendMode::Alpha
+    bool dirty = true;                     // Content changed since the last composition
+    bool stale = true;                     // Inputs changed, content must be rasterised again
+    uint32_t key = 0;                      // Inputs of the last rasterisation
+#ifdef PLED_COVERAGE
+    LedMask partial;                           // Covered LED's with a coverage below 255
+    uint8_t coverage[LedMask::BITS + 1] = {};  // Coverage of the LED's in partial, 255: fully covered
+#endif
+#ifdef PLED_INDEXED_COLOR
+    CRGBPalette16 palette = CRGBPalette16(CRGB::Black);  // Colours of the indices
+    CRGB lastColor = CRGB::Black;                        // Last colour matched to the palette
+    uint8_t lastIndex = 0;                               // Index of lastColor
+#endif
+
+    /**
+     * @brief Start rasterising a new content, all LED's are uncovered afterwards
+     */
+    inline void begin() {
+        mask.reset();
+#ifdef PLED_COVERAGE
+        partial.reset();
+#endif
+        dirty = true;
+    }
+
+    /**
+     * @brief Draw a LED of the layer
+     *
+     * @param indx - Address of LED, writes to the sink (PLedGeometry::NO_LED) are not shown
+     * @param color - Color of the LED
+     */
+    inline void put(uint8_t indx, const CRGB &color) {
+#ifdef PLED_INDEXED_COLOR
+        putIndex(indx, nearest(color));
+#else
+        px[indx] = color;
+        if (indx < LedMask::BITS) {
+            mask.set(indx);
+        }
+#endif
+    }
+
+#ifdef PLED_INDEXED_COLOR
+    /**
+     * @brief Draw a LED of the layer with a palette index
+     *
+     * @param indx - Address of LED, writes to the sink (PLedGeometry::NO_LED) are not shown
+     * @param index - Index into the palette
+     */
+    inline void putIndex(uint8_t indx, uint8_t index) {
+        px[indx] = index;
+        if (indx < LedMask::BITS) {
+            mask.set(indx);
+        }
+    }
+
+    /**
+     * @brief Change the colours of the layer, the indices are kept
+     *
+     * @param newPalette - Palette of the layer
+     */
+    inline void setPalette(const CRGBPalette16 &newPalette) {
+        palette = newPalette;
+        lastColor = palette[0];
+        lastIndex = 0;
+        dirty = true;
+    }
+
+    /**
+     * @brief Index of the palette entry closest to a colour
+     *
+     * @param color - Colour to match
+     */
+    uint8_t nearest(const CRGB &color);
+#endif
+
+#ifdef PLED_COVERAGE
+    /**
+     * @brief Let a drawn LED cover the layers below only partly, until the next begin()
+     *
+     * @param indx - Address of LED, the sink (PLedGeometry::NO_LED) is ignored
+     * @param cover - Coverage 0--255, the colour is blended with the one below by it
+     */
+    inline void setCoverage(uint8_t indx, uint8_t cover) {
+        coverage[indx] = cover;
+        if (indx < LedMask::BITS) {
+            partial.set(indx);
+        }
+    }
+#endif
+
+    /**
+     * @brief Draw all LED's of the layer in one color
+     *
+     * @param color - Color of the LED's
+     */
+    inline void fill(const CRGB &color) {
+#ifdef PLED_INDEXED_COLOR
+        PLedPixel pixel = nearest(color);
+#else
+        const CRGB &pixel = color;
+#endif
+        for (uint8_t i = 0; i < LedMask::BITS; i++) {
+            px[i] = pixel;
+        }
+        mask.setAll();
+        dirty = true;
+    }
+
+    /**
+     * @brief Mark the layer for rasterising on its next update
+     */
+    inline void invalidate() {
+        stale = true;
+    }
+
+    /**
+     * @brief Check if the layer has to be rasterised for these inputs and remember them
+     *
+     * @param inputs - Everything the content depends on beside the settings, packed into a key
+     * @return true - Inputs changed or layer invalidated, rasterise now
+     * @return false - Content is still valid
+     */
+    inline bool needsRaster(uint32_t inputs) {
+        if (!stale && (key == inputs)) {
+            return false;
+        }
+        stale = false;
+        key = inputs;
+        return true;
+    }
+};
+
+class PLedCompositor {
+   public:
+    /**
+     * @brief Layers from bottom to top
+     */
+    enum Layer : uint8_t { Background,
+                           Frame,
+                           Foreground,
+                           Overlay,
+                           LayerCount };
+
+#ifdef PLED_DIRECT_LAYERS
+    static const uint8_t BufferCount = 2;  // Layers with a buffer, Background and Foreground
+#else
+    static const uint8_t BufferCount = LayerCount;
+#endif
+
+    /**
+     * @brief Check if a layer has a buffer, the others are drawn by the caller after compose()
+     */
+    static constexpr bool isBuffered(Layer layer) {
+#ifdef PLED_DIRECT_LAYERS
+        return (layer == Background) || (layer == Foreground);
+#else
+        return layer < LayerCount;
+#endif
+    }
+
+    /**
+     * @brief Buffer of a layer, only for layers with isBuffered()
+     */
+    inline PLedLayer &operator[](Layer layer) {
+        return layers[slot(layer)];
+    }
+    inline const PLedLayer &operator[](Layer layer) const {
+        return layers[slot(layer)];
+    }
+
+    /**
+     * @brief Check if any layer changed or fades since the last composition
+     */
+    bool isDirty() const;
+
+#ifdef PLED_CROSSFADE
+    /**
+     * @brief Fade a layer from its current content to the one rasterised next
+     *
+     * May be called from another task than the one composing, the fade starts with the next
+     * updateFades(). A fade requested while one runs starts from the content at that time.
+     *
+     * @param layer - Layer to fade
+     * @param steps - Length of the fade in animation steps, 1 or more
+     */
+    inline void fadeLayer(Layer layer, uint16_t steps) {
+        if (isBuffered(layer)) {
+            fades[slot(layer)].requested = steps;
+        }
+    }
+
+    /**
+     * @brief Start the requested fades and advance the running ones, call before rasterising
+     *
+     * @param steps - Animation steps since the last call
+     */
+    void updateFades(uint8_t steps);
+
+    /**
+     * @brief Check if a layer is fading
+     */
+    inline bool isFading(Layer layer) const {
+        return isBuffered(layer) && (fades[slot(layer)].length != 0);
+    }
+#endif
+
+    /**
+     * @brief Merge all buffered layers in one pass, LED's not covered by any layer are black
+     *
+     * @param out - LED buffer to write
+     * @param nLeds - Nbr of LED's in out
+     */
+    void compose(CRGB *out, uint8_t nLeds);
+
+   private:
+    static constexpr uint8_t slot(Layer layer) {
+#ifdef PLED_DIRECT_LAYERS
+        return layer >> 1;  // Background 0, Foreground 1
+#else
+        return layer;
+#endif
+    }
+
+    PLedLayer layers[BufferCount];
+#ifdef PLED_CROSSFADE
+    struct Fade {
+        PLedLayer from;                  // Content of the layer at the start of the fade
+        uint16_t length = 0;             // Steps of the fade, 0: not fading
+        uint16_t elapsed = 0;            // Steps done
+        volatile uint16_t requested = 0; // Length of a fade to start with the next update
+        uint8_t weight = 0;              // Share of the new content, x/256
+        uint8_t lerp[256];               // v * weight / 256
+    } fades[BufferCount];
+#endif
+};
@@ -5,226 +5,889 @@
  */
 
 #include "PLedDisp.h"
+
+#ifdef PLED_PROFILING
+static_assert((uint8_t)PLedProfiler::Background == (uint8_t)PLedCompositor::Background &&
+                  (uint8_t)PLedProfiler::Frame == (uint8_t)PLedCompositor::Frame &&
+                  (uint8_t)PLedProfiler::Foreground == (uint8_t)PLedCompositor::Foreground,
+              "Plan steps are profiled as the stage of their layer");
+#endif
+
+#ifdef PLED_INDEXED_COLOR
+// Palettes of the effects, matched to the colours they draw
+static const TProgmemRGBPalette16 TwinkleColors_p PLED_FLASH = {
+    0x000000, 0x080808, 0x101010, 0x181818, 0x202020, 0x282828, 0x303030, 0x383838,
+    0x404040, 0x484848, 0x505050, 0x585858, 0x606060, 0x686868, 0x707070, 0x787878};
+static const TProgmemRGBPalette16 StormColors_p PLED_FLASH = {
+    0x000000, 0x101010, 0x181818, 0x202020, 0x282828, 0x303030, 0x383838, 0x404040,
+    0x808080, 0x000041, 0xFFFF00, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000};
+static const TProgmemRGBPalette16 ClipColors_p PLED_FLASH = {
+    0x000000, 0x202020, 0x808080, 0xFFFFFF, 0x400800, 0x802000, 0xFF6000, 0xFFD040,
+    0xFF0000, 0x00FF00, 0x0000FF, 0x00FFFF, 0xFF00FF, 0x200830, 0x402050, 0x203060};
+#ifndef PLED_DIRECT_LAYERS
+static const TProgmemRGBPalette16 WarningColors_p PLED_FLASH = {
+    0x000000, 0xFF8C00, 0xFF0000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000,
+    0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000};
+#endif
+#endif
+#ifdef PLED_VM
+// Built-in program of ModeBG::Program, a slowly drifting plasma, see tools/vmasm.py:
+// frame: t dup add store r0
+// pixel: x push 24 mul load r0 add sin8 y push 40 mul t add sin8 add push 1 shr push 240
+//        x push 64 mul y push 64 mul t push 8 mul add noise push 2 shr push 128 add hsv
+static const uint8_t VM_PLASMA[] = {
+    0x56, 0x01, 0x05, 0x2A, 0x06, 0x09, 0x10, 0x08, 0x00, 0x03, 0x01, 0x18, 0x12, 0x07, 0x00, 0x10,
+    0x20, 0x04, 0x01, 0x28, 0x12, 0x06, 0x10, 0x20, 0x10, 0x01, 0x01, 0x1A, 0x01, 0xF0, 0x03, 0x01,
+    0x40, 0x12, 0x04, 0x01, 0x40, 0x12, 0x06, 0x01, 0x08, 0x12, 0x10, 0x22, 0x01, 0x02, 0x1A, 0x01,
+    0x80, 0x10, 0x30};
+#endif
 //=====PUBLIC====================================================================================
 PLedDisp::PLedDisp() {
-    FastLED.addLeds<WS2812, LED_PIN, GRB>(leds, NUM_LEDS).setCorrection(TypicalLEDStrip);
+    FastLED.addLeds<WS2812, LED_PIN, GRB>(leds[0], NUM_LEDS).setCorrection(LED_CORRECTION);
+    output.begin(leds[0], leds[OUTPUT_BUFFERS - 1], NUM_LEDS);
+#ifdef PLED_PROFILING
+    output.setProfiler(&profiler);
+#endif
     // limit my draw to 8A at 5v of power draw
     FastLED.setMaxPowerInVoltsAndMilliamps(5, 2000);
     // FastLED.setBrightness(  BRIGHTNESS );
     FastLED.clear();
     FastLED.show();
     FastLED.setMaxRefreshRate(REFRESH_RATE_HZ);
-    FastLED.setBrightness(80);
-    CHSV bg_colour(64, 255, 190);
+    setBrightness(80);
+    bg_colour = CHSV(64, 255, 190);
+#ifdef PLED_VM
+    vm.load(VM_PLASMA, sizeof(VM_PLASMA));
+#endif
+    update_palettes();
+    lastFrameHash = hashFrame();
+    lastBrightness = brightness;
 }
 
 PLedDisp::~PLedDisp() {
 }
 
-void PLedDisp::setBackgroundMode(ModeBG mode) {
+void PLedDisp::setBackgroundMode(ModeBG mode, uint16_t fadeMs) {
+    if (mode != Bg.Mode) {
+        fade(PLedCompositor::Background, fadeMs);
+    }
     this->Bg.Mode = mode;
+    compositor[PLedCompositor::Background].invalidate();
+    planStale = true;
+    if (mode == ModeBG::Clip) {
+        clipStart = clip;  // Clips always start over, keyframes draw on the ones before
+    }
+    update_palettes();
 }
-void PLedDisp::setBackgroundColor(CRGB color) {
+void PLedDisp::setBackgroundColor(CRGB color, uint16_t fadeMs) {
+    if (color != Bg.Color) {
+        fade(PLedCompositor::Background, fadeMs);
+    }
     this->Bg.Color = color;
+    compositor[PLedCompositor::Background].invalidate();
+    planStale = true;
+    update_palettes();
 }
 
-void PLedDisp::setFrameMode(ModeFR mode) {
+void PLedDisp::playClip(PLedClipSource *clip) {
+    this->clip = (clip != nullptr) ? clip : &builtinClip;
+    setBackgroundMode(ModeBG::Clip);
+}
+
+#ifdef PLED_VM
+PLedVm::Error PLedDisp::loadProgram(const uint8_t *program, uint16_t size) {
+    PLedVm::Error error = vm.load(program, size);
+    if (error == PLedVm::Error::Ok) {
+        setBackgroundMode(ModeBG::Program);
+    }
+    return error;
+}
+#endif
+
+void PLedDisp::setFrameMode(ModeFR mode, uint16_t fadeMs) {
+    if (mode != Fr.Mode) {
+        fade(PLedCompositor::Frame, fadeMs);
+    }
     this->Fr.Mode = mode;
+#ifndef PLED_DIRECT_LAYERS
+    compositor[PLedCompositor::Frame].invalidate();
+#endif
+    planStale = true;
+    update_palettes();
 }
 
-void PLedDisp::setFrameColor(CRGB color) {
+void PLedDisp::setFrameColor(CRGB color, uint16_t fadeMs) {
+    if (color != Fr.Color) {
+        fade(PLedCompositor::Frame, fadeMs);
+    }
     this->Fr.Color = color;
+#ifndef PLED_DIRECT_LAYERS
+    compositor[PLedCompositor::Frame].invalidate();
+#endif
+    planStale = true;
+    update_palettes();
 }
 
-void PLedDisp::setForegroundMode(ModeFG mode, bool TextSlanted) {
+void PLedDisp::setForegroundMode(ModeFG mode, bool TextSlanted, uint16_t fadeMs) {
+    if ((mode != Fg.Mode) || (TextSlanted != Fg.is_slant)) {
+        fade(PLedCompositor::Foreground, fadeMs);
+    }
     this->Fg.is_slant = TextSlanted;
     this->Fg.Mode = mode;
+#ifdef PLED_COVERAGE
+    for (Morph &morph : morphs) {
+        morph = Morph();  // The digits of the new mode show up at once
+    }
+#endif
+    compositor[PLedCompositor::Foreground].invalidate();
+    planStale = true;
+    update_shader();
+    update_palettes();
 }
-void PLedDisp::setForegroundColor(CRGB color) {
+void PLedDisp::setForegroundColor(CRGB color, uint16_t fadeMs) {
+    if (color != Fg.Color) {
+        fade(PLedCompositor::Foreground, fadeMs);
+    }
     this->Fg.Color = color;
+    compositor[PLedCompositor::Foreground].invalidate();
+    planStale = true;
+    update_palettes();
+}
+
+void PLedDisp::setForegroundShade(ShadeFG shade, CRGB second, uint16_t fadeMs) {
+    if ((shade != Fg.Shade) || (second != Fg.Second)) {
+        fade(PLedCompositor::Foreground, fadeMs);
+    }
+    this->Fg.Shade = shade;
+    this->Fg.Second = second;
+    compositor[PLedCompositor::Foreground].invalidate();
+    planStale = true;
+    update_shader();
+    update_palettes();
 }
 
+void PLedDisp::setDigitColor(uint8_t digit, CRGB color, uint16_t fadeMs) {
+    if (digit >= PLedShade::DIGIT_COUNT) {
+        return;
+    }
+    if (color != Fg.DigitColors[digit]) {
+        fade(PLedCompositor::Foreground, fadeMs);
+    }
+    this->Fg.DigitColors[digit] = color;
+    compositor[PLedCompositor::Foreground].invalidate();
+    planStale = true;
+    update_palettes();
+}
+
+#ifdef PLED_COVERAGE
+void PLedDisp::setDigitMorph(uint16_t ms) {
+    uint16_t steps = (ms + ANIMATION_STEP_MS - 1) / ANIMATION_STEP_MS;
+    morphSteps = (steps < 255) ? steps : 255;
+}
+
+void PLedDisp::setSmoothMotion(bool smooth) {
+    smoothMotion = smooth;
+    compositor[PLedCompositor::Foreground].invalidate();
+}
+#endif
+
 void PLedDisp::setWarning(uint indicator, bool statusOk, uint Level) {
     if (indicator < sizeof(ErrorIndicator) / sizeof(ErrorIndicator[0])) {
-        ErrorIndicator[indicator] = ((statusOk == false) * Level);
+        int level = ((statusOk == false) * Level);
+        if (level != ErrorIndicator[indicator]) {
+            ErrorIndicator[indicator] = level;
+#ifndef PLED_DIRECT_LAYERS
+            compositor[PLedCompositor::Overlay].invalidate();
+#endif
+            planStale = true;
+        }
+    }
+}
+
+void PLedDisp::setLabel(const char *text, PLedLayout::Align align) {
+#ifdef BUILD_FOR_ESP32
+    portENTER_CRITICAL(&labelLock);
+#endif
+    strncpy(labelPending, text, PLedLayout::TEXT_MAX);
+    labelPending[PLedLayout::TEXT_MAX] = '\0';
+    labelPendingAlign = align;
+    hasLabelPending = true;
+#ifdef BUILD_FOR_ESP32
+    portEXIT_CRITICAL(&labelLock);
+#endif
+}
+
+void PLedDisp::setLayerBlend(PLedCompositor::Layer layer, BlendMode blend, uint8_t alpha) {
+    if (!PLedCompositor::isBuffered(layer)) {
+        return;
     }
+    compositor[layer].blend = blend;
+    compositor[layer].alpha = alpha;
+    compositor[layer].dirty = true;
 }
 
 void PLedDisp::update_LEDs() {
-    currentMillis = millis();
-    if ((currentMillis - previousMillis) > FRAME_TIME_MS) {
-        previousMillis = currentMillis;
-    } else {
+    PLED_PROFILE(profiler, Total, render());
+}
+
+void PLedDisp::setRefreshRate(uint8_t hz) {
+    if (hz == 0) {
+        return;
+    }
+    refreshRateHz = hz;
+    if (!dithering) {
+        animationClock.setFramePeriod(1000 / hz);
+        FastLED.setMaxRefreshRate(hz);
+    }
+}
+
+void PLedDisp::setTemporalDithering(bool enable, uint8_t hz) {
+#ifdef PLED_TEMPORAL_DITHERING
+    // One word, the render task never sees the enable of one call with the rate of another
+    uint8_t rate = (hz != 0) ? hz : (ditherRequest & DITHER_HZ);
+    ditherRequest = (enable ? DITHER_ON : 0) | rate;
+#endif
+}
+
+//=====PRIVATE====================================================================================
+void PLedDisp::render() {
+    update_output();
+    uint8_t steps = animationClock.tick(millis());
+    rainbow.set(bg_colour.sat, bg_colour.val);
+#ifdef PLED_CROSSFADE
+    compositor.updateFades(steps);  // Keeps the old content of layers about to change
+#endif
+
+    // update the layers, each one is only rasterised again when its inputs changed
+    if (planStale) {
+        PLED_PROFILE(profiler, Plan, compile_plan());
+    }
+    for (uint8_t i = 0; i < planLength; i++) {
+        const PlanStep &step = plan[i];
+#ifdef PLED_PROFILING
+        uint32_t start = PLedProfiler::cycles();
+        (this->*step.run)(step, steps);
+        profiler.record(PLedProfiler::Stage(step.layer), PLedProfiler::cycles() - start);
+#else
+        (this->*step.run)(step, steps);
+#endif
+    }
+
+#ifdef PLED_TEMPORAL_DITHERING
+    if (dithering) {
+        // Every frame is sent, the dither error moves on even while the content is unchanged
+        bool changed = false;
+        PLED_PROFILE(profiler, Compose, {
+            if (is_dirty() || (brightness != lastBrightness) || resendFrame) {
+                compose(output.back());
+                update_dither_target(output.back());
+                lastBrightness = brightness;
+                resendFrame = false;
+                changed = true;
+            }
+            if (!ditherBlack) {
+                dither(output.back());
+            }
+        });
+        // A black frame stays black whatever the error, e.g. all modes off at night
+        if (ditherBlack && !changed) {
+            frameStats.skipped++;
+            return;
+        }
+        output.present();
+        frameStats.sent++;
         return;
     }
+#endif
+
+    // Nothing changed since the last frame sent
+    if (!is_dirty() && (brightness == lastBrightness) && !resendFrame) {
+        frameStats.skipped++;
+        return;
+    }
+
+    // Only transmit frames which differ from the one already on the strip
+    uint32_t frameHash;
+    PLED_PROFILE(profiler, Compose, compose(output.back()); frameHash = hashFrame());
+    if ((frameHash != lastFrameHash) || resendFrame) {
+        lastFrameHash = frameHash;
+        lastBrightness = brightness;
+        resendFrame = false;
+        output.present();
+        frameStats.sent++;
+    } else {
+        frameStats.skipped++;
+    }
+}
+
+bool PLedDisp::is_dirty() const {
+#ifdef PLED_DIRECT_LAYERS
+    if (directDirty) {
+        return true;
+    }
+#endif
+    return compositor.isDirty();
+}
+
+void PLedDisp::compose(CRGB *out) {
+    compositor.compose(out, NUM_LEDS);
+#ifdef PLED_DIRECT_LAYERS
+    draw_direct(out);
+#endif
+}
+
+#ifdef PLED_DIRECT_LAYERS
+void PLedDisp::draw_direct(CRGB *out) {
+    // The frame lies between background and foreground, it only shows where no digit is drawn
+    const LedMask &foreground = compositor[PLedCompositor::Foreground].mask;
+    for (uint8_t i = 0; i < frameLength; i++) {
+        uint8_t led = PLedGeometry::frame(i);
+        if ((led < NUM_LEDS) && !foreground.test(led)) {
+            out[led] = Fr.Color;
+        }
+    }
+    for (uint8_t i = 0; i < (sizeof(ErrorIndicator) / sizeof(ErrorIndicator[0])); i++) {
+        uint8_t led = PLedGeometry::warning(i);
+        if ((led < NUM_LEDS) && (ErrorIndicator[i] != 0)) {
+            out[led] = (ErrorIndicator[i] == 1) ? CRGB(CRGB::DarkOrange) : CRGB(CRGB::Red);
+        }
+    }
+    directDirty = false;
+}
+#endif
+
+void PLedDisp::update_output() {
+#ifdef PLED_TEMPORAL_DITHERING
+    uint16_t request = ditherRequest;
+    bool enable = request & DITHER_ON;
+    uint8_t hz = request & DITHER_HZ;
+    if ((enable != dithering) || (hz != ditherRefreshRateHz)) {
+        ditherRefreshRateHz = hz;
+        if (enable != dithering) {
+            dithering = enable;
+            resendFrame = true;
+            // Brightness and correction are applied by the dithering, FastLED passes the values through
+            output.waitIdle();
+            FastLED.setBrightness(dithering ? 255 : brightness);
+            FastLED[0].setCorrection(dithering ? CRGB(UncorrectedColor) : LED_CORRECTION);
+            FastLED.setDither(dithering ? DISABLE_DITHER : BINARY_DITHER);
+            if (dithering) {
+                // Spread the phases, LED's with the same colour do not flicker in sync
+                for (int i = 0; i < NUM_LEDS; i++) {
+                    for (uint8_t ch = 0; ch < 3; ch++) {
+                        ditherError[i][ch] = i * 97 + ch * 31;
+                    }
+                }
+            }
+        }
+        animationClock.setFramePeriod(1000 / getRefreshRate());
+        FastLED.setMaxRefreshRate(getRefreshRate());
+    }
+#endif
+    if (!dithering && (FastLED.getBrightness() != brightness)) {
+        output.waitIdle();
+        FastLED.setBrightness(brightness);
+    }
+}
+
+void PLedDisp::fade(PLedCompositor::Layer layer, uint16_t fadeMs) {
+#ifdef PLED_CROSSFADE
+    if (fadeMs != 0) {
+        compositor.fadeLayer(layer, (fadeMs + ANIMATION_STEP_MS - 1) / ANIMATION_STEP_MS);
+    }
+#endif
+}
+
+uint32_t PLedDisp::hashFrame() const {
+    const uint8_t *data = reinterpret_cast<const uint8_t *>(output.back());
+    uint32_t hash = 2166136261UL;
+    for (unsigned int i = 0; i < NUM_LEDS * sizeof(CRGB); i++) {
+        hash = (hash ^ data[i]) * 16777619UL;
+    }
+    return (hash ^ brightness) * 16777619UL;
+}
+
+#ifdef PLED_TEMPORAL_DITHERING
+void PLedDisp::update_dither_target(const CRGB *frame) {
+    // brightness * correction, scaled so that 255 * factor >> 8 fits 16 bit
+    uint16_t factor[3];
+    for (uint8_t ch = 0; ch < 3; ch++) {
+        factor[ch] = brightness * (LED_CORRECTION.raw[ch] + 1);
+    }
+    ditherBlack = true;
+    for (int i = 0; i < NUM_LEDS; i++) {
+        for (uint8_t ch = 0; ch < 3; ch++) {
+            ditherTarget[i][ch] = (uint32_t(frame[i].raw[ch]) * factor[ch]) >> 8;
+            if (ditherTarget[i][ch] != 0) {
+                ditherBlack = false;
+            }
+        }
+    }
+}
 
-    // update the background
+void PLedDisp::dither(CRGB *out) {
+    for (int i = 0; i < NUM_LEDS; i++) {
+        for (uint8_t ch = 0; ch < 3; ch++) {
+            uint16_t level = ditherTarget[i][ch] + ditherError[i][ch];
+            out[i].raw[ch] = level >> 8;
+            ditherError[i][ch] = level & 0xFF;
+        }
+    }
+}
+#endif
+
+void PLedDisp::compile_plan() {
+    planStale = false;
+    planLength = 0;
+
+    PLedLayer &background = compositor[PLedCompositor::Background];
     switch (Bg.Mode) {
-        case ModeBG::None:
-            FastLED.clear();
-            break;
         case ModeBG::SolidColor:
-            bg_solidColor(Bg);
+            if (background.needsRaster(0)) {
+                if (Bg.Color == CRGB(CRGB::Black)) {
+                    background.begin();  // Same as no background, without blending 128 black LED's
+                } else {
+                    bg_solidColor(Bg);
+                }
+            }
             break;
         case ModeBG::ScrollingRainbow:
-            bg_rainbow();
+            add_step(&PLedDisp::run_rainbow, nullptr, PLedCompositor::Background);
             break;
         case ModeBG::Twinkle:
-            FastLED.clear();
-            bg_twinkle();
+            add_step(&PLedDisp::run_animation, &PLedDisp::bg_twinkle, PLedCompositor::Background);
             break;
         case ModeBG::Fireworks:
-            FastLED.clear();
-            bg_firework();
+            add_step(&PLedDisp::run_animation, &PLedDisp::bg_firework, PLedCompositor::Background);
             break;
         case ModeBG::Thunderstorm:
-            FastLED.clear();
-            bg_rain();
+            add_step(&PLedDisp::run_animation, &PLedDisp::bg_rain, PLedCompositor::Background);
             break;
         case ModeBG::Firepit:
-            FastLED.clear();
-            bg_firepit();
+            if (background.needsRaster(0)) {
+                background.begin();  // With PLED_INDEXED_COLOR the heat is the layer, the old content must not burn
+            }
+            add_step(&PLedDisp::run_steps, &PLedDisp::bg_firepit, PLedCompositor::Background);
+            break;
+        case ModeBG::Clip:
+            add_step(&PLedDisp::run_steps, &PLedDisp::bg_clip, PLedCompositor::Background);
+            break;
+        case ModeBG::Program:
+            add_step(&PLedDisp::run_animation, &PLedDisp::bg_program, PLedCompositor::Background);
             break;
         default:
+            if (background.needsRaster(0)) {
+                background.begin();
+            }
             break;
     }
 
-    // update the frame
+#ifdef PLED_DIRECT_LAYERS
+    // Frame and warnings are drawn into the LED buffer after composing, see draw_direct()
+    frameLength = (Fr.Mode == ModeFR::SolidColor) ? PLedGeometry::FRAME_LENGTH : 0;
+    if (Fr.Mode == ModeFR::Time) {
+        add_step(&PLedDisp::run_frame_time, nullptr, PLedCompositor::Frame);
+    }
+    directDirty = true;
+#else
+    PLedLayer &frame = compositor[PLedCompositor::Frame];
     switch (Fr.Mode) {
-        case ModeFR::None:
+        case ModeFR::SolidColor:
+            if (frame.needsRaster(0)) {
+                frame.begin();
+                fr_solidColor(Fr);
+            }
             break;
         case ModeFR::Time:
-            fr_time(TIME_NOW, Fr);
+            add_step(&PLedDisp::run_frame_time, nullptr, PLedCompositor::Frame);
             break;
-        case ModeFR::SolidColor:
-            fr_solidColor(Fr);
         default:
+            if (frame.needsRaster(0)) {
+                frame.begin();
+            }
             break;
     }
+#endif
 
-    // update the foreground
+    PLedLayer &foreground = compositor[PLedCompositor::Foreground];
     switch (Fg.Mode) {
         case ModeFG::Time:
         case ModeFG::TimeRainbow:
-            disp_time(TIME_NOW, Fg);
-
-            break;
-        case ModeFG::None:  // No operation
+            add_step(&PLedDisp::run_time, nullptr, PLedCompositor::Foreground);
             break;
         case ModeFG::Cycle:
-            disp_number((cycle_counter / 1000) % 10, (cycle_counter / 100) % 10, (cycle_counter / 10) % 10, cycle_counter % 10, Fg);
-            cycle_counter++;
-            if (cycle_counter >= 10000)
-                cycle_counter = 0;
+            add_step(&PLedDisp::run_cycle, nullptr, PLedCompositor::Foreground);
+            break;
+#ifdef PLED_SCROLLING_TEXT
+        case ModeFG::Text:
+            add_step(&PLedDisp::run_text, nullptr, PLedCompositor::Foreground);
+            break;
+#endif
+        case ModeFG::Label:
+            add_step(&PLedDisp::run_label, nullptr, PLedCompositor::Foreground);
             break;
         default:
+            if (foreground.needsRaster(0)) {
+                foreground.begin();
+            }
             break;
     }
 
+#ifndef PLED_DIRECT_LAYERS
+    if (compositor[PLedCompositor::Overlay].needsRaster(0)) {
+        update_overlay();
+    }
+#endif
+}
+
+void PLedDisp::add_step(void (PLedDisp::*run)(const PlanStep &, uint8_t), void (PLedDisp::*draw)(), PLedCompositor::Layer layer) {
+    if (planLength < PLAN_MAX) {
+        plan[planLength++] = {run, draw, layer};
+    }
+}
+
+void PLedDisp::run_animation(const PlanStep &step, uint8_t steps) {
+    PLedLayer &layer = compositor[step.layer];
+    for (uint8_t i = 0; i < steps; i++) {
+        layer.begin();
+        (this->*step.draw)();
+    }
+}
+
+void PLedDisp::run_steps(const PlanStep &step, uint8_t steps) {
+    for (uint8_t i = 0; i < steps; i++) {
+        (this->*step.draw)();
+    }
+}
+
+void PLedDisp::run_rainbow(const PlanStep &step, uint8_t steps) {
+    // The gradient only moves every few steps
+    rainbowScroll.advance(steps);
+    if (compositor[step.layer].needsRaster(rainbowScroll.getStart())) {
+        bg_rainbow();
+    }
+}
+
+void PLedDisp::run_frame_time(const PlanStep &step, uint8_t steps) {
+#ifdef PLED_DIRECT_LAYERS
+    uint8_t length = frame_length(TIME_NOW);
+    if (length != frameLength) {
+        frameLength = length;
+        directDirty = true;
+    }
+#else
+    PLedLayer &layer = compositor[step.layer];
+    if (layer.needsRaster(TIME_NOW.second())) {
+        layer.begin();
+        fr_time(TIME_NOW, Fr);
+    }
+#endif
+}
+
+void PLedDisp::run_time(const PlanStep &step, uint8_t steps) {
+    PLedLayer &layer = compositor[step.layer];
+
+    // Digits and seconds tick only change with the time (and the hue for rainbow time)
+    uint32_t inputs = ((TIME_NOW.hour() * 60UL + TIME_NOW.minute()) << 1) | (TIME_NOW.second() % 2 == 0);
+    if (Fg.Mode == ModeFG::TimeRainbow) {
+        rainbowScroll.advance(steps);
+        inputs = (inputs << 8) | rainbowScroll.getStart();
+    }
+#ifdef PLED_COVERAGE
+    if (advance_morphs(steps)) {
+        layer.invalidate();  // Every step of a morph is drawn
+    }
+#endif
+    if (layer.needsRaster(inputs)) {
+        layer.begin();
+        disp_time(TIME_NOW, Fg);
+    }
+}
+
+void PLedDisp::run_cycle(const PlanStep &step, uint8_t steps) {
+    if (steps == 0) {
+        return;
+    }
+    // One number per step, the last one is shown
+    cycle_counter = (cycle_counter + steps - 1) % 10000;
+    compositor[step.layer].begin();
+    disp_number((cycle_counter / 1000) % 10, (cycle_counter / 100) % 10, (cycle_counter / 10) % 10, cycle_counter % 10, Fg);
+    cycle_counter++;
+    if (cycle_counter >= 10000)
+        cycle_counter = 0;
+}
+
+#ifdef PLED_SCROLLING_TEXT
+void PLedDisp::run_text(const PlanStep &step, uint8_t steps) {
+    PLedLayer &layer = compositor[step.layer];
+    scrollText.advance(steps);
+#ifdef PLED_COVERAGE
+    if (smoothMotion) {
+        // Drawn at every position, not only when the text moved by a column
+        if (layer.needsRaster(((uint32_t)scrollText.getScrolled() << 8) | scrollText.getFraction())) {
+            layer.begin();
+            LedMask mask;
+            uint8_t cover[LedMask::BITS + 1] = {};
+            scrollText.draw(mask, cover);
+            disp_mask(mask, Fg, 0);
+            cover_mask(mask, cover);
+        }
+        return;
+    }
+#endif
+    if (layer.needsRaster(scrollText.getScrolled())) {
+        layer.begin();
+        LedMask mask;
+        scrollText.draw(mask);
+        disp_mask(mask, Fg, 0);
+    }
+}
+#endif
+
+void PLedDisp::run_label(const PlanStep &step, uint8_t steps) {
+    PLedLayer &layer = compositor[step.layer];
+    if (hasLabelPending) {
+        // Text and alignment are taken over together, a setLabel() on another task waits meanwhile
+#ifdef BUILD_FOR_ESP32
+        portENTER_CRITICAL(&labelLock);
+#endif
+        memcpy(labelText, labelPending, sizeof(labelText));
+        labelAlign = labelPendingAlign;
+        hasLabelPending = false;
+#ifdef BUILD_FOR_ESP32
+        portEXIT_CRITICAL(&labelLock);
+#endif
+    }
+    label.set(labelText, Fg.is_slant, labelAlign);
+    int16_t offset = labelOffset;
+    if (layer.needsRaster(((uint32_t)label.getVersion() << 16) | (uint16_t)offset)) {
+        layer.begin();
+#ifdef PLED_COVERAGE
+        if (smoothMotion) {
+            LedMask all;
+            uint8_t cover[LedMask::BITS + 1] = {};
+            for (uint8_t i = 0; i < label.getCount(); i++) {
+                LedMask mask;
+                label.drawAt(i, offset, mask, cover);
+                disp_mask(mask, Fg, (i < PLedShade::DIGIT_COUNT) ? i : PLedShade::GLYPH_COLON);
+                all |= mask;
+            }
+            cover_mask(all, cover);
+            return;
+        }
+#endif
+        for (uint8_t i = 0; i < label.getCount(); i++) {
+            LedMask mask;
+            label.draw(i, mask, (offset + PLedSubpixel::COLUMN / 2) >> 8);
+            disp_mask(mask, Fg, (i < PLedShade::DIGIT_COUNT) ? i : PLedShade::GLYPH_COLON);
+        }
+    }
+}
+
+#ifndef PLED_DIRECT_LAYERS
+void PLedDisp::update_overlay() {
+    PLedLayer &layer = compositor[PLedCompositor::Overlay];
+
     // Display warnings/Errors
+    layer.begin();
     for (int i = 0; i < (sizeof(ErrorIndicator) / sizeof(ErrorIndicator[0])); i++) {
         switch (ErrorIndicator[i]) {
             case 1:  // warning
-                leds[ErrorIndicatorAdr[i]] = CRGB::DarkOrange;
+                layer.put(PLedGeometry::warning(i), CRGB::DarkOrange);
                 break;
             case 2:  // error
-                leds[ErrorIndicatorAdr[i]] = CRGB::Red;
+                layer.put(PLedGeometry::warning(i), CRGB::Red);
                 break;
         }
     }
-    FastLED.show();
 }
+#endif
 
-//=====PRIVATE====================================================================================
-/** ================ FOREGROUND ================ **/
+void PLedDisp::update_shader() {
+    if ((Fg.Mode == ModeFG::TimeRainbow) || (Fg.Mode == ModeFG::Cycle)) {
+        Fg.kernel = PLedShade::KERNELS[PLedShade::Rainbow];
+        return;
+    }
+    switch (Fg.Shade) {
+        case ShadeFG::Gradient:
+            Fg.kernel = PLedShade::KERNELS[PLedShade::Gradient];
+            break;
+        case ShadeFG::Digits:
+            Fg.kernel = PLedShade::KERNELS[PLedShade::Digits];
+            break;
+        default:
+            Fg.kernel = PLedShade::KERNELS[PLedShade::Solid];
+            break;
+    }
+}
 
-void PLedDisp::disp_time(DateTime &time, Foreground &fg) {
-    if ((fg.Mode == ModeFG::TimeRainbow) || (fg.Mode == ModeFG::Cycle)) {
-        if (bg_counter < REFRESH_RATE_HZ / 4)
-            bg_counter++;
-        else {
-            bg_colour.hue = (bg_colour.hue + 1) % 256;
-            bg_counter = 0;
+void PLedDisp::update_palettes() {
+#ifdef PLED_INDEXED_COLOR
+    CRGBPalette16 rainbowPalette(RainbowColors_p);
+    for (uint8_t i = 0; i < 16; i++) {
+        rainbowPalette[i].nscale8(bg_colour.val);
+    }
+
+    switch (Bg.Mode) {
+        case ModeBG::SolidColor:
+            compositor[PLedCompositor::Background].setPalette(CRGBPalette16(Bg.Color));
+            break;
+        case ModeBG::ScrollingRainbow:
+            compositor[PLedCompositor::Background].setPalette(rainbowPalette);
+            break;
+        case ModeBG::Twinkle:
+            compositor[PLedCompositor::Background].setPalette(TwinkleColors_p);
+            break;
+        case ModeBG::Fireworks:
+            compositor[PLedCompositor::Background].setPalette(RainbowColors_p);
+            break;
+        case ModeBG::Thunderstorm:
+            compositor[PLedCompositor::Background].setPalette(StormColors_p);
+            break;
+        case ModeBG::Firepit:
+            compositor[PLedCompositor::Background].setPalette(HeatColors_p);
+            break;
+        case ModeBG::Clip:
+            compositor[PLedCompositor::Background].setPalette(ClipColors_p);
+            break;
+        case ModeBG::Program:
+            compositor[PLedCompositor::Background].setPalette(RainbowColors_p);
+            break;
+        default:
+            break;
+    }
+#ifndef PLED_DIRECT_LAYERS
+    compositor[PLedCompositor::Frame].setPalette(CRGBPalette16(Fr.Color));
+#endif
+    // Entries as the shading kernels index them, see PLedShade::ENTRY_STEP
+    CRGBPalette16 fgPalette(Fg.Color);
+    if ((Fg.Mode == ModeFG::TimeRainbow) || (Fg.Mode == ModeFG::Cycle)) {
+        fgPalette = rainbowPalette;
+    } else if (Fg.Shade == ShadeFG::Gradient) {
+        for (uint8_t row = 0; row < PLedGeometry::ROWS; row++) {
+            fgPalette[row] = PLedShade::gradientRow(Fg.Color, Fg.Second, row);
+        }
+    } else if (Fg.Shade == ShadeFG::Digits) {
+        for (uint8_t digit = 0; digit < PLedShade::DIGIT_COUNT; digit++) {
+            fgPalette[digit] = Fg.DigitColors[digit];
         }
     }
+    compositor[PLedCompositor::Foreground].setPalette(fgPalette);
+#ifndef PLED_DIRECT_LAYERS
+    compositor[PLedCompositor::Overlay].setPalette(WarningColors_p);
+#endif
+#endif
+}
+
+/** ================ FOREGROUND ================ **/
+
+void PLedDisp::disp_time(DateTime &time, Foreground &fg) {
+    using namespace PLedGeometry;
 
     // Write Digits
-    disp_digit(time.hour() / 10, 0, fg);          // 1. Digit 10Hours
-    disp_digit(time.hour() % 10, 28, fg);         // 2. Digit 1Hour
-    disp_digit(time.minute() / 10, 70, fg);       // 3. Digit 10 Min
-    disp_digit(time.minute() % 10, 70 + 28, fg);  // 4. Digit 1Min
+    disp_digit(time.hour() / 10, 0, TIME_SLOTS[0], fg);    // 1. Digit 10Hours
+    disp_digit(time.hour() % 10, 1, TIME_SLOTS[1], fg);    // 2. Digit 1Hour
+    disp_digit(time.minute() / 10, 2, TIME_SLOTS[2], fg);  // 3. Digit 10 Min
+    disp_digit(time.minute() % 10, 3, TIME_SLOTS[3], fg);  // 4. Digit 1Min
 
     // seconds tick ":" between Digit 2 and 3 refreshed all 2 seconds
     if (time.second() % 2 == 0) {
-        // Upper dot
-        leds[66] = fg_palette(66, fg);
-
-        // Lower dot
-        if (fg.is_slant) {
-            leds[59] = fg_palette(59, fg);
-        } else {
-            leds[64] = fg_palette(64, fg);
+        disp_mask(colonMask(fg.is_slant), fg, PLedShade::GLYPH_COLON);
+    }
+}
+
+void PLedDisp::disp_digit(uint8_t digit, uint8_t glyph, uint8_t slot, Foreground &fg) {
+    using namespace PLedGeometry;
+
+    disp_mask(glyphMask(digit, slot, fg.is_slant), fg, glyph);
+#ifdef PLED_COVERAGE
+    Morph &morph = morphs[glyph];
+    if (digit != morph.to) {
+        // The first digit shows up at once, later ones morph from the digit shown
+        morph.from = ((morph.to != NO_DIGIT) && (morphSteps != 0)) ? morph.to : digit;
+        morph.to = digit;
+        morph.step = 0;
+    }
+    if (morph.from == morph.to) {
+        return;
+    }
+
+    // Only the LED's in the precomputed difference of both digits fade
+    PLedLayer &layer = compositor[PLedCompositor::Foreground];
+    uint8_t fade = (morph.step * 255) / morphSteps;
+    uint8_t leaving = morphLeaving(morph.from, morph.to, fg.is_slant);
+    uint8_t count = leaving + morphJoining(morph.from, morph.to, fg.is_slant);
+    LedMask leavingMask;
+    for (uint8_t i = 0; i < leaving; i++) {
+        uint8_t led = morphLed(morph.from, morph.to, i, slot, fg.is_slant);
+        if (led != NO_LED) {
+            leavingMask.set(led);
         }
     }
+    disp_mask(leavingMask, fg, glyph);
+    for (uint8_t i = 0; i < count; i++) {
+        layer.setCoverage(morphLed(morph.from, morph.to, i, slot, fg.is_slant), (i < leaving) ? 255 - fade : fade);
+    }
+#endif
 }
 
+#ifdef PLED_COVERAGE
+bool PLedDisp::advance_morphs(uint8_t steps) {
+    bool morphing = false;
+    for (Morph &morph : morphs) {
+        if (morph.from == morph.to) {
+            continue;
+        }
+        morphing = true;
+        morph.step = (morph.step + steps < morphSteps) ? morph.step + steps : morphSteps;
+        if (morph.step == morphSteps) {
+            morph.from = morph.to;  // Done, drawn once more without fading LED's
+        }
+    }
+    return morphing;
+}
+#endif
+
 void PLedDisp::disp_number(uint8_t Digit3, uint8_t Digit2, uint8_t Digit1, uint8_t Digit0, Foreground &fg) {
+    using namespace PLedGeometry;
+
     // Write Digits
     int NbrForDisplay = Digit3 * 1000 + Digit2 * 100 + Digit1 * 10 + Digit0 * 1;
 
     // Hide leading zero
     if (NbrForDisplay >= 1000) {
-        disp_digit(Digit3, 14, fg);
+        disp_mask(glyphMask(Digit3, NUMBER_SLOTS[0], fg.is_slant), fg, 0);
     }
     if (NbrForDisplay >= 100) {
-        disp_digit(Digit2, 42, fg);
+        disp_mask(glyphMask(Digit2, NUMBER_SLOTS[1], fg.is_slant), fg, 1);
     }
     if (NbrForDisplay >= 10) {
-        disp_digit(Digit1, 70, fg);
+        disp_mask(glyphMask(Digit1, NUMBER_SLOTS[2], fg.is_slant), fg, 2);
     }
     if (NbrForDisplay >= 0) {
-        disp_digit(Digit0, 70 + 28, fg);
+        disp_mask(glyphMask(Digit0, NUMBER_SLOTS[3], fg.is_slant), fg, 3);
     }
 }
 
-void PLedDisp::disp_digit(int num, int offset, Foreground &fg) {
-    if (fg.is_slant) {
-        for (int i = 0; i < slant_digits_len[num]; i++) {
-            int indx = slant_digits[num][i] + offset - 28;
-            if (indx < 7)
-                indx++;  // adjust when LEDS really close to the start of the strip
-            if (indx >= 0 && indx < 128)
-                leds[indx] = fg_palette(indx, fg);
-        }
-    } else {
-        for (int i = 0; i < digits_len[num]; i++) {
-            leds[digits[num][i] + offset] = fg_palette(digits[num][i] + offset, fg);
-        }
-    }
+void PLedDisp::disp_mask(const LedMask &mask, Foreground &fg, uint8_t glyph) {
+    const PLedShade::Context ctx = {fg.Color, fg.Second, fg.DigitColors, &rainbow, &rainbowScroll, glyph};
+    fg.kernel(compositor[PLedCompositor::Foreground], mask, ctx);
 }
 
-CRGB PLedDisp::fg_palette(int indx, Foreground &fg) {
-    // Check if index is valid
-    if (indx < 0 && indx >= NUM_LEDS) {
-        return CRGB::Black;
-    }
-    // Mode Scrolling Rainbow Time or Cyclic
-    if ((fg.Mode == ModeFG::TimeRainbow) || (fg.Mode == ModeFG::Cycle)) {
-        return CHSV((bg_colour.hue + indx) % 256, bg_colour.sat, bg_colour.val);
-    }
-
-    return fg.Color;
-}
-void PLedDisp::fr_solidColor(Frame &fr) {
-    for (int i = 0; i < sizeof(frame) / sizeof(frame[0]); i++) {
-        if ((frame[i] >= 0) and (frame[i] <= (sizeof(leds) / sizeof(leds[0])))) {
-            leds[frame[i]] = fr.Color;
+#ifdef PLED_COVERAGE
+void PLedDisp::cover_mask(const LedMask &mask, const uint8_t *cover) {
+    PLedLayer &layer = compositor[PLedCompositor::Foreground];
+    // LED's lit by two glyph columns may add up to full coverage
+    mask.forEach([&](uint8_t led) {
+        if (cover[led] < PLedSubpixel::FULL) {
+            layer.setCoverage(led, cover[led]);
         }
-    }
+    });
 }
+#endif
 
-void PLedDisp::fr_time(DateTime &time, Frame &fr) {
-    int framelength = sizeof(frame) / sizeof(frame[0]);
+uint8_t PLedDisp::frame_length(DateTime &time) {
+    int framelength = PLedGeometry::FRAME_LENGTH;
     int length = ((time.second() * double(framelength)) / 59);
 
     if (length < 0) {
@@ -232,198 +895,199 @@ void PLedDisp::fr_time(DateTime &time, Frame &fr) {
     } else if (length > framelength) {
         length = framelength;
     }
+    return length;
+}
+
+#ifndef PLED_DIRECT_LAYERS
+void PLedDisp::fr_solidColor(Frame &fr) {
+    PLedLayer &layer = compositor[PLedCompositor::Frame];
+
+    for (int i = 0; i < PLedGeometry::FRAME_LENGTH; i++) {
+        layer.put(PLedGeometry::frame(i), fr.Color);
+    }
+}
+
+void PLedDisp::fr_time(DateTime &time, Frame &fr) {
+    PLedLayer &layer = compositor[PLedCompositor::Frame];
+    uint8_t length = frame_length(time);
 
     for (int i = 0; i < length; i++) {
-        if ((frame[i] >= 0) and (frame[i] <= (sizeof(leds) / sizeof(leds[0])))) {
-            leds[frame[i]] = fr.Color;
-        }
+        layer.put(PLedGeometry::frame(i), fr.Color);
     }
 }
+#endif
 
 /** ================ BACKGROUND ================ **/
 void PLedDisp::bg_solidColor(Background &bg) {
-    for (int i = 0; i < NUM_LEDS; i++) {
-        leds[i] = bg.Color;
-    }
+    compositor[PLedCompositor::Background].fill(bg.Color);
 }
 void PLedDisp::bg_rainbow() {
-    if (bg_counter < REFRESH_RATE_HZ / 4)
-        bg_counter++;
-    else {
-        bg_colour.hue = (bg_colour.hue + 1) % 256;
-        bg_counter = 0;
-    }
+    PLedLayer &layer = compositor[PLedCompositor::Background];
 
     // show half the hues
-    for (int i = 0; i < NUM_LEDS; i++) {
-        leds[i] = CHSV((bg_colour.hue + i) % 256, bg_colour.sat, bg_colour.val);
-    }
+    layer.begin();
+    rainbowScroll.forEach(NUM_LEDS, [&](uint16_t led, uint16_t hue) {
+#ifdef PLED_INDEXED_COLOR
+        layer.putIndex(led, hue);
+#else
+        layer.put(led, rainbow.at(hue));
+#endif
+    });
 }
 
 void PLedDisp::bg_twinkle() {
-    int empty_slot = -1;
-    for (int i = 0; i < MAX_TWINKLES; i++) {
-        if (twinkles[i].pos == -1) {
-            empty_slot = i;
-            break;
-        }
-    }
-    if (random8() < 96 && empty_slot != -1) {
-        twinkles[empty_slot].pos = random(NUM_LEDS);
-        twinkles[empty_slot].stage = 16;
-    }
-
-    for (int i = 0; i < MAX_TWINKLES; i++) {
-        if (twinkles[i].pos != -1 && twinkles[i].stage > 0) {
-            int brightness = 8 * twinkles[i].stage;
-            leds[twinkles[i].pos] = CRGB(brightness, brightness, brightness);  // set to white/gray
-            twinkles[i].stage--;
-            if (twinkles[i].stage == 0)
-                twinkles[i].pos = -1;
-        }
-    }
+    twinkles.step(rng,
+        96,
+        [&](uint8_t i) {
+            twinkles.pos[i] = rng.random8(NUM_LEDS);
+            twinkles.stage[i] = 16;
+        },
+        [&](uint8_t i) { return update_twinkle(i); });
 }
 
 void PLedDisp::bg_rain() {
-    int empty_slot = -1;
+    PLedLayer &layer = compositor[PLedCompositor::Background];
     // Set background
     for (int i = 3; i < 20; i++) {
-        leds[led_address[0][i]] = CRGB::Gray;
+        layer.put(led_address(0, i), CRGB::Gray);
     }
     for (int i = 2; i < 20; i++) {
-        leds[led_address[1][i]] = CHSV(0, 0, random8(64, 128));
+        layer.put(led_address(1, i), CHSV(0, 0, rng.random8(64, 128)));
     }
 
-    for (int i = 0; i < MAX_RAINDROPS; i++) {
-        if (raindrops[i].pos == -1) {
-            empty_slot = i;
-            break;
-        }
-    }
+    raindrops.step(rng,
+        200,
+        [&](uint8_t i) {
+            raindrops.pos[i] = rng.random8(3, 21);  // 3--20
+            raindrops.stage[i] = 1;
+            raindrops.flags[i] = (rng.random8(0, 20) / 19) ? RAIN_LIGHTNING : 0;  // lightning ~5%
+            rain_path[0][i] = raindrops.pos[i];                               // remember the path the raindrop takes
+        },
+        [&](uint8_t i) { return update_raindrop(i); });
+}
 
-    if (random8() < 200 && empty_slot != -1) {
-        raindrops[empty_slot].pos = random8(3, 21);  // 3--20
-        raindrops[empty_slot].stage = 1;
-        raindrops[empty_slot].lightning = random8(0, 20) / 19;          // 0--1 with 1 happening ~5%
-        raindrops[empty_slot].prev_pos[0] = raindrops[empty_slot].pos;  // remember the path the raindrop takes
-    }
-
-    for (int i = 0; i < MAX_RAINDROPS; i++) {
-        if (raindrops[i].pos != -1 && raindrops[i].stage > 0) {
-            if (raindrops[i].lightning != 0 && raindrops[i].stage == 1) {
-                int x = raindrops[i].pos;
-                for (int j = 1; j <= 6; j++) {
-                    x -= random8(0, 2);
-                    x = (x >= 0 && x < 20) ? x : 0;
-                    int indx = led_address[j][x];
-                    if (indx >= 0 && indx < NUM_LEDS) {
-                        leds[indx] = CRGB::Yellow;
-                        raindrops[i].prev_pos[j - 1] = indx;
-                    }
-                }
-            } else if (raindrops[i].lightning != 0 && raindrops[i].stage > 1 && raindrops[i].stage < 7) {
-                for (int j = 0; j < 6; j++)
-                    leds[raindrops[i].prev_pos[j]] = CRGB::Yellow;
-            } else {  // rain
-                int x = raindrops[i].prev_pos[raindrops[i].stage - 1] - random8(0, 2);
-                x = (x >= 0 && x < 20) ? x : 0;
-                raindrops[i].prev_pos[raindrops[i].stage] = x;
-                int indx = led_address[raindrops[i].stage][x];
-                if (indx >= 0 && indx < NUM_LEDS)
-                    leds[indx] = CHSV(HUE_BLUE, 255, 128);
-                else
-                    raindrops[i].stage = 6;
-            }
+void PLedDisp::bg_firework() {
+    fireworks.step(rng,
+        24,
+        [&](uint8_t i) {
+            fireworks.pos[i] = rng.random8(3, 14);  // 3--13
+            fireworks.stage[i] = FIREWORK_START_STAGE;
+            fireworks.flags[i] = rng.random8(0, 2) ? FIREWORK_RIGHT : 0;
+            fireworks.hue[i] = rng.random8();  // 0--255
+            fireworks.flags[i] |= rng.random8(0, 2) ? FIREWORK_LOW : 0;
+        },
+        [&](uint8_t i) { return update_firework(i); });
+}
 
-            raindrops[i].stage++;
-            if (raindrops[i].stage == 7 && raindrops[i].lightning != 0) {
-                raindrops[i].pos = -1;
-                for (int j = 0; j < 6; j++)
-                    leds[raindrops[i].prev_pos[j]] = CRGB::Black;
-            } else if (raindrops[i].stage == 7 && raindrops[i].lightning == 0)
-                raindrops[i].pos = -1;
-        }
-    }
+void PLedDisp::bg_firepit() {
+    fire.step(compositor[PLedCompositor::Background], rng);
 }
 
-void PLedDisp::bg_firework() {
-    const int START_STAGE = 24;  //    Starting stage
-    int empty_slot = -1;
-    for (int i = 0; i < MAX_FIREWORKS; i++) {
-        if (fireworks[i].pos == -1) {
-            empty_slot = i;
-            break;
+void PLedDisp::bg_clip() {
+    // Opened here and not by the setter, the player may still be reading the same source
+    PLedClipSource *start = clipStart;
+    if (start != nullptr) {
+        clipStart = nullptr;
+        if (!clipPlayer.begin(start)) {
+            clipPlayer.begin(&builtinClip);
         }
     }
+    clipPlayer.step(compositor[PLedCompositor::Background]);
+}
+
+void PLedDisp::bg_program() {
+#ifdef PLED_VM
+    vm.run(compositor[PLedCompositor::Background], rng);
+#endif
+}
 
-    if (random8() < 24 && empty_slot != -1) {
-        fireworks[empty_slot].pos = random8(3, 14);  // 3--13
-        fireworks[empty_slot].stage = START_STAGE;
-        fireworks[empty_slot].direction = random8(0, 2);      // 0--1
-        fireworks[empty_slot].hue = random8();                // 0--255
-        fireworks[empty_slot].height_offset = random8(0, 2);  // 0--1
-    }
-
-    for (int i = 0; i < MAX_FIREWORKS; i++) {
-        if (fireworks[i].pos != -1 && fireworks[i].stage > 0) {
-            // final position of firework explosion
-            int y = 2 + fireworks[i].height_offset;
-            int x = fireworks[i].pos + 4 * fireworks[i].direction;
-
-            if (fireworks[i].stage == START_STAGE)
-                // Set startpoint to white
-                leds[led_address[6][fireworks[i].pos]] = CRGB::White;
-            else if (fireworks[i].stage >= (20 + fireworks[i].height_offset)) {
-                int level = 6 - (24 - fireworks[i].stage);
-                leds[led_address[level][fireworks[i].pos + (6 - level) * fireworks[i].direction]] = CRGB::White;
-                leds[led_address[level + 1][fireworks[i].pos + (6 - level + 1) * fireworks[i].direction]] = CRGB::Black;
-            } else if ((fireworks[i].stage == 18) || (fireworks[i].stage == 17)) {
-                // explode in 6 directions from (x,y)
-                leds[led_address[y][x]] = CRGB::Black;
-                leds[led_address[y - 1][x + 1]] = CHSV(fireworks[i].hue, 255, 255);
-                leds[led_address[y][x + 1]] = CHSV(fireworks[i].hue, 255, 255);
-                leds[led_address[y + 1][x]] = CHSV(fireworks[i].hue, 255, 255);
-                leds[led_address[y + 1][x - 1]] = CHSV(fireworks[i].hue, 255, 255);
-                leds[led_address[y][x - 1]] = CHSV(fireworks[i].hue, 255, 255);
-                leds[led_address[y - 1][x]] = CHSV(fireworks[i].hue, 255, 255);
-            } else if (fireworks[i].stage == 16) {
-                // explode in 6 directions from (x,y)
-                leds[led_address[y][x]] = CRGB::Black;
-                leds[led_address[y - 1][x + 1]] = CRGB::Black;
-                leds[led_address[y][x + 1]] = CRGB::Black;
-                leds[led_address[y + 1][x]] = CRGB::Black;
-                leds[led_address[y + 1][x - 1]] = CRGB::Black;
-                leds[led_address[y][x - 1]] = CRGB::Black;
-                leds[led_address[y - 1][x]] = CRGB::Black;
-
-                leds[led_address[y - 2][x + 2]] = CHSV(fireworks[i].hue, 255, 255);
-                leds[led_address[y][x + 2]] = CHSV(fireworks[i].hue, 255, 255);
-                leds[led_address[y + 2][x]] = CHSV(fireworks[i].hue, 255, 255);
-                leds[led_address[y + 2][x - 2]] = CHSV(fireworks[i].hue, 255, 255);
-                leds[led_address[y][x - 2]] = CHSV(fireworks[i].hue, 255, 255);
-                leds[led_address[y - 2][x]] = CHSV(fireworks[i].hue, 255, 255);
-            } else if (fireworks[i].stage > 0) {
-                // explode in 6 directions from (x,y) and fade
-                int brightness = 16 * fireworks[i].stage;
-                leds[led_address[y - 2][x + 2]] = CHSV(fireworks[i].hue, 255, brightness);
-                leds[led_address[y][x + 2]] = CHSV(fireworks[i].hue, 255, brightness);
-                leds[led_address[y + 2][x]] = CHSV(fireworks[i].hue, 255, brightness);
-                leds[led_address[y + 2][x - 2]] = CHSV(fireworks[i].hue, 255, brightness);
-                leds[led_address[y][x - 2]] = CHSV(fireworks[i].hue, 255, brightness);
-                leds[led_address[y - 2][x]] = CHSV(fireworks[i].hue, 255, brightness);
+bool PLedDisp::update_twinkle(uint8_t i) {
+    int brightness = 8 * twinkles.stage[i];
+    compositor[PLedCompositor::Background].put(twinkles.pos[i], CRGB(brightness, brightness, brightness));  // set to white/gray
+    twinkles.stage[i]--;
+    return twinkles.stage[i] != 0;
+}
+
+bool PLedDisp::update_raindrop(uint8_t i) {
+    PLedLayer &layer = compositor[PLedCompositor::Background];
+    bool lightning = raindrops.flags[i] & RAIN_LIGHTNING;
+    uint8_t &stage = raindrops.stage[i];
+
+    if (lightning && stage == 1) {
+        int x = raindrops.pos[i];
+        for (int j = 1; j <= 6; j++) {
+            x -= rng.random8(0, 2);
+            x = (x >= 0 && x < 20) ? x : 0;
+            uint8_t indx = led_address(j, x);
+            if (indx < NUM_LEDS) {
+                layer.put(indx, CRGB::Yellow);
+                rain_path[j - 1][i] = indx;
             }
+        }
+    } else if (lightning && stage > 1 && stage < 7) {
+        for (int j = 0; j < 6; j++)
+            layer.put(rain_path[j][i], CRGB::Yellow);
+    } else {  // rain
+        int x = rain_path[stage - 1][i] - rng.random8(0, 2);
+        x = (x >= 0 && x < 20) ? x : 0;
+        rain_path[stage][i] = x;
+        uint8_t indx = led_address(stage, x);
+        if (indx < NUM_LEDS)
+            layer.put(indx, CHSV(HUE_BLUE, 255, 128));
+        else
+            stage = 6;
+    }
 
-            fireworks[i].stage--;
-            if (fireworks[i].stage == 0)
-                fireworks[i].pos = -1;
+    stage++;
+    if (stage == 7) {
+        if (lightning) {
+            for (int j = 0; j < 6; j++)
+                layer.put(rain_path[j][i], CRGB::Black);
         }
+        return false;
     }
+    return true;
 }
 
-void PLedDisp::bg_firepit() {
-    for (int level = 6; level > 2; level--) {
-        for (int i = 0; i < 17 + (6 - level); i++) {
-            leds[led_address[level][i]] = CHSV(HUE_RED + random8(8), 255, random8(192 - (6 - level) * 64, 255 - (6 - level) * 64));
+bool PLedDisp::update_firework(uint8_t i) {
+    PLedLayer &layer = compositor[PLedCompositor::Background];
+    int pos = fireworks.pos[i];
+    int stage = fireworks.stage[i];
+    int direction = (fireworks.flags[i] & FIREWORK_RIGHT) ? 1 : 0;
+    int height_offset = (fireworks.flags[i] & FIREWORK_LOW) ? 1 : 0;
+    uint8_t hue = fireworks.hue[i];
+
+    // final position of firework explosion
+    uint8_t centre = led_address(2 + height_offset, pos + 4 * direction);
+
+    if (stage == FIREWORK_START_STAGE)
+        // Set startpoint to white
+        layer.put(led_address(6, pos), CRGB::White);
+    else if (stage >= (20 + height_offset)) {
+        int level = 6 - (24 - stage);
+        layer.put(led_address(level, pos + (6 - level) * direction), CRGB::White);
+        layer.put(led_address(level + 1, pos + (6 - level + 1) * direction), CRGB::Black);
+    } else if ((stage == 18) || (stage == 17)) {
+        // explode in 6 directions from the centre
+        layer.put(centre, CRGB::Black);
+        for (uint8_t dir = 0; dir < PLedGeometry::NEIGHBOURS; dir++) {
+            layer.put(PLedGeometry::neighbour(centre, dir), CHSV(hue, 255, 255));
+        }
+    } else if (stage == 16) {
+        // move the explosion one step further out
+        layer.put(centre, CRGB::Black);
+        for (uint8_t dir = 0; dir < PLedGeometry::NEIGHBOURS; dir++) {
+            layer.put(PLedGeometry::neighbour(centre, dir), CRGB::Black);
+            layer.put(PLedGeometry::ring2(centre, 2 * dir), CHSV(hue, 255, 255));
+        }
+    } else if (stage > 0) {
+        // fade the outer ring
+        int brightness = 16 * stage;
+        for (uint8_t dir = 0; dir < PLedGeometry::NEIGHBOURS; dir++) {
+            layer.put(PLedGeometry::ring2(centre, 2 * dir), CHSV(hue, 255, brightness));
         }
     }
-}
\ No newline at end of file
+
+    fireworks.stage[i]--;
+    return fireworks.stage[i] != 0;
+}
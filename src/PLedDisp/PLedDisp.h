@@ -16,17 +16,50 @@
 #include <FastLED.h>
 #include <RTClib.h>  // Adafruit RTClib
 
+#include "PLedClip.h"
+#include "PLedClips.h"
+#include "PLedClock.h"
+#include "PLedColorRamp.h"
+#include "PLedCompositor.h"
+#include "PLedFire.h"
+#include "PLedGeometry.h"
+#include "PLedLayout.h"
+#include "PLedOutput.h"
+#include "PLedParticles.h"
+#include "PLedProfiler.h"
+#include "PLedRandom.h"
+#include "PLedScroll.h"
+#include "PLedShade.h"
+#include "PLedText.h"
+#include "PLedVm.h"
+
 // IO-MAPPING
 #ifdef BUILD_FOR_NANO
 const int LED_PIN = 6;
 #elif BUILD_FOR_ESP32
 const int LED_PIN = 23;
+#elif BUILD_FOR_NATIVE
+const int LED_PIN = 0;  // Host simulation, see sim/shim
+#endif
+const int NUM_LEDS = PLedGeometry::LED_COUNT;  // Nbr of LEDS's in Display
+#ifdef BUILD_FOR_NANO
+const int OUTPUT_BUFFERS = 1;  // No RAM for a second frame
+#else
+const int OUTPUT_BUFFERS = 2;  // Render the next frame while the last one is transmitted
+#endif
+static_assert(NUM_LEDS <= LedMask::BITS, "Layers and masks hold at most LedMask::BITS LED's");
+#ifndef BUILD_FOR_NANO
+#define PLED_TEMPORAL_DITHERING  // 16 bit frame and dither error need 1.2 kB RAM
+#define PLED_VM                  // Bytecode backgrounds, the program is held twice
+#define PLED_SCROLLING_TEXT      // ModeFG::Text, the text is held twice
 #endif
-const int NUM_LEDS = 128;  // Nbr of LEDS's in Display
+const uint8_t DITHER_REFRESH_RATE_HZ = 120;  // Default refresh rate with temporal dithering
+const uint16_t DIGIT_MORPH_MS = 400;         // Default length of the morph of a changing time digit
+const CRGB LED_CORRECTION = TypicalLEDStrip;  // Colour correction of the strip
 
-const int MAX_TWINKLES = 8;
-const int MAX_RAINDROPS = 16;
-const int MAX_FIREWORKS = 5;
+const uint8_t MAX_TWINKLES = 8;    // Particle pool sizes, at most 32 each
+const uint8_t MAX_RAINDROPS = 16;
+const uint8_t MAX_FIREWORKS = 5;
 extern RTC_Millis RTC_TIME;
 extern DateTime TIME_NOW;
 
@@ -36,7 +69,18 @@ class PLedDisp {
     enum class ModeFG { None,         // no op (time doesn't show)
                         Time,         // time
                         TimeRainbow,  // rainbow time,
-                        Cycle         // cycle through all digits 0--9999 quickly
+                        Cycle,        // cycle through all digits 0--9999 quickly
+                        Text,         // scrolling text, see setText(), shows nothing on the Nano
+                        Label         // still label e.g. a temperature or countdown, see setLabel()
+    };
+
+    /**
+     * @brief Colouring of the digits in ModeFG::Time, ModeFG::Text, ModeFG::Label and ModeFG::None, the rainbow modes
+     * always show the rainbow
+     */
+    enum class ShadeFG { Solid,     // Foreground colour
+                         Gradient,  // Foreground colour in the top row to the second colour in the bottom row
+                         Digits     // Own colour per digit, see setDigitColor(), the colon in the foreground colour
     };
 
     /**
@@ -48,7 +92,9 @@ class PLedDisp {
                         Twinkle,           // Twinkle
                         Fireworks,         // Fireworks
                         Thunderstorm,      // Thunderstorm
-                        Firepit            // Firepit (works well with single colour time mode set to a light teal)
+                        Firepit,           // Firepit (works well with single colour time mode set to a light teal)
+                        Clip,              // Animation clip, see playClip()
+                        Program            // Bytecode program, see loadProgram(), not on the Nano
     };
 
     enum class ModeFR { None,        // No background
@@ -56,6 +102,14 @@ class PLedDisp {
                         Time         // Like a seconds display
     };
 
+    /**
+     * @brief Counters of composed frames sent to or skipped for the LED strip
+     */
+    struct FrameStats {
+        uint32_t sent = 0;     // Frames transmitted with FastLED.show()
+        uint32_t skipped = 0;  // Frames identical to the last transmitted one
+    };
+
     /**
      * @brief Construct a new PLedDisp object
      *
@@ -72,44 +126,164 @@ class PLedDisp {
      * @brief Set the Background Mode
      *
      * @param mode - Background mode to set e.g. ModeBG::Firepit
+     * @param fadeMs - Crossfade from the current background, 0 switches at once (always on the Nano)
      */
-    void setBackgroundMode(ModeBG mode);
+    void setBackgroundMode(ModeBG mode, uint16_t fadeMs = 0);
 
     /**
      * @brief Set the Background Color object when Mode solidColor is active
      *
      * @param color - Backgroundcolor e.g. CRGB::Red
+     * @param fadeMs - Crossfade from the current background, 0 switches at once
      */
-    void setBackgroundColor(CRGB color);
+    void setBackgroundColor(CRGB color, uint16_t fadeMs = 0);
+
+    /**
+     * @brief Play an animation clip as background, sets ModeBG::Clip
+     *
+     * The clip is opened by the next update_LEDs(), the source is only read from the task
+     * rendering. A source that is no clip of this format plays the built-in clip instead.
+     *
+     * @param clip - Source of the clip, must stay valid while playing, nullptr for the built-in clip
+     */
+    void playClip(PLedClipSource *clip);
+
+#ifdef PLED_VM
+    /**
+     * @brief Run a bytecode program as background, sets ModeBG::Program
+     *
+     * The program is checked once here, see PLedVm. Until the first one is loaded a built-in
+     * plasma runs.
+     *
+     * @param program - Program as assembled by tools/vmasm.py, may be released after the call
+     * @param size - Bytes of program
+     * @return PLedVm::Error - PLedVm::Error::Ok if it runs, otherwise the mode is unchanged
+     */
+    PLedVm::Error loadProgram(const uint8_t *program, uint16_t size);
+#endif
 
     /**
      * @brief Set the Frame Mode object
      *
      * @param mode - Frame mode to set e.g ModeFR::Time
+     * @param fadeMs - Crossfade from the current frame, 0 switches at once
      */
-    void setFrameMode(ModeFR mode);
+    void setFrameMode(ModeFR mode, uint16_t fadeMs = 0);
 
     /**
      * @brief Set the Frame Color object when Mode solidColor is active
      *
      * @param color - Framecolor e.g. CRGB::Red
+     * @param fadeMs - Crossfade from the current frame, 0 switches at once
      */
-    void setFrameColor(CRGB color);
+    void setFrameColor(CRGB color, uint16_t fadeMs = 0);
 
     /**
      * @brief Set the Foreground Mode object
      *
      * @param mode - Frame mode to set e.g ModeFG::Time
      * @param TextSlanted - Default false. Set true if text should be displayed italic/slanted.
+     * @param fadeMs - Crossfade from the current foreground, 0 switches at once
      */
-    void setForegroundMode(ModeFG mode, bool TextSlanted = false);
+    void setForegroundMode(ModeFG mode, bool TextSlanted = false, uint16_t fadeMs = 0);
 
     /**
      * @brief Set the Foreground Color object
      *
      * @param color - Foreground e.g. CRGB::Red
+     * @param fadeMs - Crossfade from the current foreground, 0 switches at once
+     */
+    void setForegroundColor(CRGB color, uint16_t fadeMs = 0);
+
+    /**
+     * @brief Set how the digits are coloured
+     *
+     * @param shade - Shading e.g. ShadeFG::Gradient
+     * @param second - Bottom colour of ShadeFG::Gradient
+     * @param fadeMs - Crossfade from the current foreground, 0 switches at once
+     */
+    void setForegroundShade(ShadeFG shade, CRGB second = CRGB::Black, uint16_t fadeMs = 0);
+
+    /**
+     * @brief Set the colour of one digit for ShadeFG::Digits
+     *
+     * @param digit - 0--3 from the left, the scrolling text has the colour of digit 0, glyphs of a
+     * label after the 4th the foreground colour
+     * @param color - Colour of the digit
+     * @param fadeMs - Crossfade from the current foreground, 0 switches at once
+     */
+    void setDigitColor(uint8_t digit, CRGB color, uint16_t fadeMs = 0);
+
+#ifdef PLED_SCROLLING_TEXT
+    /**
+     * @brief Set the text of ModeFG::Text, shown in the foreground colour and shading
+     *
+     * A new text starts when the current one has scrolled out, so texts updated while they are
+     * shown (e.g. a temperature) don't jump.
+     *
+     * @param text - Text up to PLedText::TEXT_MAX characters, see PLedFont for the characters
+     */
+    inline void setText(const char *text) {
+        scrollText.setText(text);
+    }
+
+    /**
+     * @brief Set the speed of the scrolling text
+     *
+     * @param colsPerSecond - Columns per second, about 4 characters fit onto the display
+     */
+    inline void setTextSpeed(uint8_t colsPerSecond) {
+        scrollText.setSpeed((colsPerSecond * 256) / ANIMATION_RATE_HZ);
+    }
+#endif
+
+    /**
+     * @brief Set the label of ModeFG::Label, shown in the foreground colour and shading
+     *
+     * The glyphs are kerned and aligned on the display, in the style of the digits (see
+     * setForegroundMode()). The label is only laid out again when it changed, so it may be set
+     * every loop, e.g. to a countdown. May be called from another task than the one rendering,
+     * the label is copied aside and taken over by the next update_LEDs().
+     *
+     * @param text - Label up to PLedLayout::TEXT_MAX characters, see PLedLayout for the characters
+     * @param align - Where the label goes on the display
+     */
+    void setLabel(const char *text, PLedLayout::Align align = PLedLayout::Align::Center);
+
+    /**
+     * @brief Move the label of ModeFG::Label from its aligned place, e.g. to slide it in
+     *
+     * With smooth motion (see setSmoothMotion()) the label is drawn at the exact offset, split
+     * between neighbouring balls, otherwise at the nearest whole column.
+     *
+     * @param offset - 1/256 columns (balls) to the right, negative to the left
+     */
+    inline void setLabelOffset(int16_t offset) {
+        labelOffset = offset;
+    }
+
+#ifdef PLED_COVERAGE
+    /**
+     * @brief Draw the scrolling text and the label between the balls while they move
+     *
+     * A glyph between two columns lights the balls of both, with intensities by how close it is
+     * to each (16 steps per column), so it glides even at low refresh rates. Off: they move by
+     * whole balls. On by default, not on the Nano.
+     *
+     * @param smooth - Draw between the balls
+     */
+    void setSmoothMotion(bool smooth);
+
+    /**
+     * @brief Set how long a digit of the time morphs into the next one
+     *
+     * The LED's leaving the digit fade out and the joining ones fade in over the layers below, the
+     * LED's both digits share stay lit. Not on the Nano.
+     *
+     * @param ms - Length of the morph, 0 switches at once
      */
-    void setForegroundColor(CRGB color);
+    void setDigitMorph(uint16_t ms);
+#endif
 
     /**
      * @brief Set the Warnings indicator active
@@ -120,27 +294,122 @@ class PLedDisp {
      */
     void setWarning(uint indicator, bool statusOk, uint Level = 1);
 
+    /**
+     * @brief Set how a layer is merged onto the layers below
+     *
+     * @param layer - Layer to change e.g. PLedCompositor::Frame, only layers with a buffer
+     *                (PLedCompositor::isBuffered(), on the Nano not the frame and overlay)
+     * @param blend - Blend mode e.g. BlendMode::Alpha
+     * @param alpha - Opacity 0-255 for BlendMode::Add and BlendMode::Alpha
+     */
+    void setLayerBlend(PLedCompositor::Layer layer, BlendMode blend, uint8_t alpha = 255);
+
     /**
      * @brief Updateds PingpongLed display.
-     * Changes are only visible when this function is called
+     * Changes are only visible when this function is called. Animations advance by the time
+     * elapsed since the last call, so it can be called at any rate. Only the steps of the render
+     * plan run, the plan is compiled again after a setter changed the modes or colours.
      */
     void update_LEDs();
 
+    /**
+     * @brief Set the rate update_LEDs() is called with, used to count late and dropped frames.
+     * Does not change the speed of the animations.
+     *
+     * @param hz - Refresh rate e.g. 60
+     */
+    void setRefreshRate(uint8_t hz);
+
+    /**
+     * @brief Get the rate update_LEDs() should be called with
+     *
+     * @return uint8_t - Refresh rate [Hz], the dithering one while dithering
+     */
+    inline uint8_t getRefreshRate() const {
+        return dithering ? ditherRefreshRateHz : refreshRateHz;
+    }
+
+    /**
+     * @brief High refresh mode with temporal dithering, keeps the output smooth at low brightness.
+     * Brightness and colour correction are applied with 16 bit per channel and what is below one
+     * output step is carried over to the next frames, so the average over a few frames is exact.
+     * Every frame is transmitted while dithering, except a black one: it has nothing to dither
+     * and is only sent when it changed. Not available on the Nano.
+     *
+     * May be called from another task than the one rendering, the change is made by the next
+     * update_LEDs() before it draws.
+     *
+     * @param enable - True to dither
+     * @param hz - Refresh rate while dithering, update_LEDs() has to be called at this rate
+     */
+    void setTemporalDithering(bool enable, uint8_t hz = DITHER_REFRESH_RATE_HZ);
+
     /**
      * @brief Set the Brightness object
      *
      * @param scale - a 0-255 value for how much to scale all leds before writing them out
      */
     inline void setBrightness(uint8_t scale = 255) {
-        FastLED.setBrightness(scale);
+        brightness = scale;  // Handed to FastLED by the next update_LEDs(), unless dithering
     }
 
+    /**
+     * @brief Get the LED's drawn by the foreground (digits), e.g. for hit tests of other layers
+     *
+     * @return const LedMask& - Coverage of the foreground layer
+     */
+    inline const LedMask &getForegroundMask() const {
+        return compositor[PLedCompositor::Foreground].mask;
+    }
+
+    /**
+     * @brief Restart the random numbers of the effects, the same seed renders the same frames
+     *
+     * @param seed - Seed of the generator
+     */
+    inline void seedRandom(uint32_t seed) {
+        rng.setSeed(seed);
+    }
+
+    /**
+     * @brief Get the counters of sent and skipped frames
+     *
+     * @return FrameStats - Frames sent and skipped since construction
+     */
+    inline FrameStats getFrameStats() const {
+        return frameStats;
+    }
+
+    /**
+     * @brief Get the counters of rendered, late and dropped frames
+     *
+     * @return PLedClock::Stats - Frames since construction
+     */
+    inline PLedClock::Stats getClockStats() const {
+        return animationClock.getStats();
+    }
+
+#ifdef PLED_PROFILING
+    /**
+     * @brief Get the timing of the render stages, e.g. to report them on a serial command
+     *
+     * @return PLedProfiler& - Profiler of this display
+     */
+    inline PLedProfiler &getProfiler() {
+        return profiler;
+    }
+#endif
+
     //=====PRIVATE====================================================================================
    private:
     struct Foreground {
         ModeFG Mode = ModeFG::Time;
         CRGB Color = CRGB::Peru;
         bool is_slant = true;  // Display digits as slanted
+        ShadeFG Shade = ShadeFG::Solid;
+        CRGB Second = CRGB::Black;
+        CRGB DigitColors[PLedShade::DIGIT_COUNT] = {CRGB::Peru, CRGB::Peru, CRGB::Peru, CRGB::Peru};
+        PLedShade::Kernel kernel = PLedShade::KERNELS[PLedShade::Solid];  // Shader of the mode and shade
     } Fg;
     struct Background {
         ModeBG Mode = ModeBG::SolidColor;
@@ -151,111 +420,260 @@ class PLedDisp {
         CRGB Color = CRGB::DarkGrey;
     } Fr;
 
-    CRGB leds[NUM_LEDS];  // Define the array of leds
+    CRGB leds[OUTPUT_BUFFERS][NUM_LEDS];  // Define the array of leds, composition of all layers
+    PLedCompositor compositor;
+    PLedOutput output;
     DateTime now;         // time record
-    CHSV bg_colour;
-    int ErrorIndicator[4] = {};
-    const int ErrorIndicatorAdr[4] = {118, 119, 127, 126};
-    const int REFRESH_RATE_HZ = 20;  // Refrasherate of LED's and animation
-    const int FRAME_TIME_MS = (1000 / REFRESH_RATE_HZ);
-    unsigned long currentMillis = 0;   ///< Current time for non blocking delay
-    unsigned long previousMillis = 0;  ///< Last time called for non blocking delay
+    CHSV bg_colour;         // Saturation and value of the rainbow effects, the hue is the start of rainbowScroll
+    PLedColorRamp rainbow;  // Colours of all hues at the saturation and value of bg_colour
+    int ErrorIndicator[PLedGeometry::WARNING_COUNT] = {};
+#ifdef PLED_DIRECT_LAYERS
+    uint8_t frameLength = 0;  ///< Frame LED's drawn into the LED buffer after composing
+    bool directDirty = true;  ///< Frame or warnings changed since the last composition
+#endif
+    static const int ANIMATION_RATE_HZ = 20;  // Steps per second of all animations
+    static const int ANIMATION_STEP_MS = (1000 / ANIMATION_RATE_HZ);
+    static const int REFRESH_RATE_HZ = 20;  // Default refreshrate of LED's
+    PLedClock animationClock{ANIMATION_STEP_MS, 1000 / REFRESH_RATE_HZ};
+    PLedRandom rng;  // Random numbers of all effects
+    PLedScroll rainbowScroll{256, ANIMATION_RATE_HZ / 4 + 1, 64};  // Window over the hues of the rainbow ramp
+    uint8_t refreshRateHz = REFRESH_RATE_HZ;
+    uint32_t lastFrameHash = 0;  ///< Hash of the last frame sent to the strip
+    uint8_t brightness = 0;      ///< Brightness set, applied by FastLED or by the dithering
+    uint8_t lastBrightness = 0;  ///< Brightness of the last frame sent to the strip
+    bool resendFrame = false;    ///< Send the next frame even if it did not change
+    bool dithering = false;
+    uint8_t ditherRefreshRateHz = DITHER_REFRESH_RATE_HZ;
+#ifdef PLED_TEMPORAL_DITHERING
+    static const uint16_t DITHER_ON = 0x100;  // Request bits: dithering on
+    static const uint16_t DITHER_HZ = 0xFF;   // Request bits: refresh rate while dithering
+    volatile uint16_t ditherRequest = DITHER_REFRESH_RATE_HZ;  ///< Set by setTemporalDithering(), applied by update_output()
+#endif
+#ifdef PLED_TEMPORAL_DITHERING
+    uint16_t ditherTarget[NUM_LEDS][3];  ///< Composed frame with brightness and correction, 8.8 fixed point
+    uint8_t ditherError[NUM_LEDS][3];    ///< Fraction of an output step not yet shown
+    bool ditherBlack = false;            ///< Target all black, nothing to dither
+#endif
+    FrameStats frameStats;
+#ifdef PLED_PROFILING
+    PLedProfiler profiler;
+#endif
 
     int cycle_counter = 0;  // for displaying all digits quickly 0--9999
-    int bg_counter = 0;
-
-    struct twinkle_t {
-        int pos = -1;   // LED position 0--127
-        int stage = 0;  // record of how bright each twinkle is up to. 0--16
-    } twinkles[MAX_TWINKLES];
-    struct rain_t {
-        int pos = -1;  // first row position
-        int stage = 0;
-        bool lightning = false;  // 0 normal rain, 1 is ligtning
-        int prev_pos[6];         // holds lightning positions to clear later
-    } raindrops[MAX_RAINDROPS];
-    struct firework_t {
-        int pos = -1;           // LED number in last row
-        int direction = 0;      // 0 is left, 1 is right
-        int stage = 0;          // remember where each firework animation is up to
-        char hue = 0;           // colour of each firework
-        int height_offset = 0;  // sometimes lower by one.
-    } fireworks[MAX_FIREWORKS];
-
-    /**
-     * Imagining the display as a parallelogram slanted to the left,
-     * I turned Figure 9 into a two dimensional array (look up table) with values corresponding to the strip index.
-     * For the positions that don't exist, I put values of 999.
-     *
-     *        / 012 013 ...
-     *      / 001 011   ...
-     *    / 002 010 015 ...
-     *  < 000 003 009   ...
-     *    \ 004 008 017 ...
-     *      \ 005 007   ...
-     *        \ 006 019 ...
-     *
-     * */
-
-    const int led_address[7][20] = {
-        {999, 999, 999, 12, 13, 26, 27, 40, 41, 54, 55, 68, 69, 82, 83, 96, 97, 110, 111, 124},  // 0th row
-        {999, 999, 1, 11, 14, 25, 28, 39, 42, 53, 56, 67, 70, 81, 84, 95, 98, 109, 112, 123},    // 1st row
-        {999, 2, 10, 15, 24, 29, 38, 43, 52, 57, 66, 71, 80, 85, 94, 99, 108, 113, 122, 125},    // 2nd row
-        {0, 3, 9, 16, 23, 30, 37, 44, 51, 58, 65, 72, 79, 86, 93, 100, 107, 114, 121, 126},      // 3rd row
-        {4, 8, 17, 22, 31, 36, 45, 50, 59, 64, 73, 78, 87, 92, 101, 106, 115, 120, 127, 999},    // 4th row
-        {5, 7, 18, 21, 32, 35, 46, 49, 60, 63, 74, 77, 88, 91, 102, 105, 116, 119, 999, 999},    // 5th row
-        {6, 19, 20, 33, 34, 47, 48, 61, 62, 75, 76, 89, 90, 103, 104, 117, 118, 999, 999, 999},  // 6th row
-    };
+#ifdef PLED_COVERAGE
+    static const uint8_t NO_DIGIT = 0xFF;
+    struct Morph {
+        uint8_t from = NO_DIGIT;  // Digit fading out, the same as to when not morphing
+        uint8_t to = NO_DIGIT;    // Digit fading in, NO_DIGIT: nothing shown yet
+        uint8_t step = 0;         // Animation steps done
+    } morphs[PLedShade::DIGIT_COUNT];  // Per digit of the time from the left
+    uint8_t morphSteps = (DIGIT_MORPH_MS + ANIMATION_STEP_MS - 1) / ANIMATION_STEP_MS;
+    bool smoothMotion = true;  // Moving glyphs are drawn between the balls
+#endif
 
-    /** DIGITS **/
-    // Look up tables for how to build alphanumeric characters
-    // referenced from leftmost
-    // const int digitsMatrix[10][10][2] = {
-    //     {{5, 1}, {4, 1}, {2, 2}, {1, 3}, {1, 4}, {5, 2}, {4, 3}, {2, 4}},                  // 0
-    //     {{1, 4}, {2, 3}, {3, 3}, {4, 2}, {5, 2}},                                          // 1
-    //     {{5, 1}, {4, 1}, {3, 2}, {1, 3}, {1, 4}, {3, 3}, {5, 2}, {2, 4}},                  // 2
-    //     {{5, 1}, {3, 2}, {1, 3}, {1, 4}, {3, 3}, {5, 2}, {4, 3}, {2, 4}},                  // 3
-    //     {{3, 2}, {2, 2}, {1, 3}, {3, 3}, {5, 2}, {4, 3}, {2, 4}},                          // 4
-    //     {{5, 1}, {3, 2}, {2, 2}, {1, 3}, {1, 4}, {3, 3}, {5, 2}, {4, 3}},                  // 5
-    //     {{5, 1}, {4, 1}, {3, 2}, {1, 4}, {2, 3}, {3, 3}, {5, 2}, {4, 3}},                  // 6
-    //     {{5, 1}, {1, 3}, {1, 4}, {3, 3}, {4, 2}, {2, 4}},                                  // 7
-    //     {{5, 1}, {4, 1}, {3, 2}, {2, 2}, {1, 3}, {1, 4}, {3, 3}, {5, 2}, {4, 3}, {2, 4}},  // 8
-    //     {{5, 1}, {3, 2}, {2, 2}, {1, 3}, {1, 4}, {3, 3}, {4, 2}, {2, 4}},                  // 9
-    // };
-    const int digits[10][10] = {
-        {7, 8, 10, 11, 14, 18, 22, 24},         // 0
-        {14, 15, 16, 17, 18},                   // 1
-        {7, 8, 9, 11, 14, 16, 18, 24},          // 2
-        {7, 9, 11, 14, 16, 18, 22, 24},         // 3
-        {9, 10, 11, 16, 18, 22, 24},            // 4
-        {7, 9, 10, 11, 14, 16, 18, 22},         // 5
-        {7, 8, 9, 14, 15, 16, 18, 22},          // 6
-        {7, 11, 14, 16, 17, 24},                // 7
-        {7, 8, 9, 10, 11, 14, 16, 18, 22, 24},  // 8
-        {7, 9, 10, 11, 14, 16, 17, 24},         // 9
-    };
-    const int digits_len[10] = {8, 5, 8, 8, 7, 8, 8, 6, 10, 8};
-
-    // referenced from one place to the right because not all digits will fit at leftmost
-    const int slant_digits[10][13] = {
-        {39, 42, 53, 52, 44, 45, 35, 32, 21, 31, 30, 38},      // 0
-        {35, 45, 44, 52, 53},                                  // 1
-        {39, 42, 53, 52, 44, 37, 30, 31, 21, 32, 35},          // 2
-        {39, 42, 53, 52, 44, 37, 30, 45, 35, 32, 21},          // 3
-        {39, 38, 30, 37, 44, 52, 53, 45, 35},                  // 4
-        {53, 42, 39, 38, 30, 37, 44, 45, 35, 32, 21},          // 5
-        {53, 42, 39, 38, 30, 37, 44, 45, 35, 32, 21, 31},      // 6
-        {39, 42, 53, 52, 44, 45, 35, 38},                      // 7
-        {53, 42, 39, 38, 30, 37, 44, 45, 35, 32, 21, 31, 52},  // 8
-        {53, 42, 39, 38, 30, 37, 44, 45, 35, 32, 21, 52},      // 9
+    // pos: LED position 0--127, stage: how bright the twinkle is up to 16--1
+    PLedParticles<MAX_TWINKLES> twinkles;
+    // pos: first row column, stage: row the drop is in, flags: RAIN_LIGHTNING
+    PLedParticles<MAX_RAINDROPS> raindrops;
+    uint8_t rain_path[PLedGeometry::ROWS][MAX_RAINDROPS] = {};  // Column per row of a raindrop, LED's of a lightning to clear later
+    // pos: column in last row, stage: where the animation is up to 24--1, hue: colour, flags: FIREWORK_*
+    PLedParticles<MAX_FIREWORKS> fireworks;
+    static const uint8_t RAIN_LIGHTNING = 0x01;
+    static const uint8_t FIREWORK_RIGHT = 0x01;  // Rises to the right instead of straight up
+    static const uint8_t FIREWORK_LOW = 0x02;    // Explodes one row lower
+    static const uint8_t FIREWORK_START_STAGE = 24;
+    PLedFire fire;
+    PLedFlashClip builtinClip{CLIP_SUNRISE, sizeof(CLIP_SUNRISE)};
+    PLedClipSource *clip = &builtinClip;  // Clip of ModeBG::Clip
+    PLedClipSource *volatile clipStart = nullptr;  // Clip to start on the task rendering, see bg_clip()
+    PLedClipPlayer clipPlayer;
+#ifdef PLED_SCROLLING_TEXT
+    PLedText scrollText;  // Text of ModeFG::Text
+#endif
+    PLedLayout label;     // Glyphs of ModeFG::Label
+    char labelText[PLedLayout::TEXT_MAX + 1] = "";  // Label laid out by run_label()
+    PLedLayout::Align labelAlign = PLedLayout::Align::Center;
+    char labelPending[PLedLayout::TEXT_MAX + 1];  // Label set, taken over by run_label()
+    PLedLayout::Align labelPendingAlign = PLedLayout::Align::Center;
+    volatile bool hasLabelPending = false;
+#ifdef BUILD_FOR_ESP32
+    portMUX_TYPE labelLock = portMUX_INITIALIZER_UNLOCKED;  // Guards labelPending, its alignment and hasLabelPending
+#endif
+    volatile int16_t labelOffset = 0;  // 1/256 columns, see setLabelOffset()
+#ifdef PLED_VM
+    PLedVm vm;  // Program of ModeBG::Program
+#endif
+
+    /**
+     * @brief Step of the render plan: a runner advancing and rasterising one layer
+     */
+    struct PlanStep {
+        void (PLedDisp::*run)(const PlanStep &step, uint8_t steps);
+        void (PLedDisp::*draw)();     // Effect drawn by run_animation() and run_steps(), nullptr otherwise
+        PLedCompositor::Layer layer;  // Layer drawn, also the profiler stage
     };
-    const int slant_digits_len[10] = {12, 5, 11, 11, 9, 11, 12, 8, 13, 12};
+    static const uint8_t PLAN_MAX = PLedCompositor::LayerCount;  // At most one step per layer
+    PlanStep plan[PLAN_MAX];                                     // Layers changing from frame to frame, bottom to top
+    uint8_t planLength = 0;
+    volatile bool planStale = true;  // Modes or colours changed, compile the plan before the next frame
 
-    const int frame[44] = {68, 69, 82, 83, 96, 97, 110, 111, 124,
-                           123, 125, 126, 127, 119,
-                           118, 117, 104, 103, 90, 89, 76, 75, 62, 61, 48, 47, 34, 33, 20, 19, 6,
-                           5, 4, 0, 2, 1,
-                           12, 13, 26, 27, 40, 41, 54, 55};
+    /**
+     * @brief Strip index of a lattice position, see PLedGeometry
+     *
+     * @param row - 0--6
+     * @param col - 0--19
+     * @return uint8_t - LED address or PLedGeometry::NO_LED
+     */
+    inline uint8_t led_address(uint8_t row, uint8_t col) const {
+        return PLedGeometry::address(row, col);
+    }
+
+    /**
+     * @brief Update the layers and send the frame if it changed
+     */
+    void render();
+
+    /**
+     * @brief Apply the dithering and brightness set since the last frame, on the task rendering
+     *
+     * The FastLED settings change between two transmissions, so no frame composed for the old
+     * settings is sent with the new ones.
+     */
+    void update_output();
+
+#ifdef PLED_TEMPORAL_DITHERING
+    /**
+     * @brief Scale the composed frame by brightness and colour correction into the 16 bit target
+     *
+     * Remembers in ditherBlack if all of the target is black.
+     *
+     * @param frame - Composed frame
+     */
+    void update_dither_target(const CRGB *frame);
+
+    /**
+     * @brief Write the next temporally dithered frame of the target
+     *
+     * @param out - LED buffer to write
+     */
+    void dither(CRGB *out);
+#endif
+
+    /**
+     * @brief Crossfade a layer to the content of its new settings, nothing without PLED_CROSSFADE
+     *
+     * @param layer - Layer about to change
+     * @param fadeMs - Length of the fade, 0 switches at once
+     */
+    void fade(PLedCompositor::Layer layer, uint16_t fadeMs);
+
+    /**
+     * @brief Check if anything on the display changed since the last composition
+     */
+    bool is_dirty() const;
+
+    /**
+     * @brief Merge the layers into a LED buffer
+     *
+     * @param out - LED buffer, NUM_LEDS entries
+     */
+    void compose(CRGB *out);
+
+#ifdef PLED_DIRECT_LAYERS
+    /**
+     * @brief Draw the frame and the warnings into the composed LED buffer (no layer buffers)
+     *
+     * The frame only replaces LED's the foreground does not cover, so it stays below the digits.
+     *
+     * @param out - LED buffer, NUM_LEDS entries
+     */
+    void draw_direct(CRGB *out);
+#endif
+
+    /**
+     * @brief Hash the composed frame in the back buffer and the brightness it will be sent with (FNV-1a)
+     *
+     * @return uint32_t - Frame hash
+     */
+    uint32_t hashFrame() const;
+
+    /**
+     * @brief Compile the modes into the render plan
+     *
+     * Layers that don't change from frame to frame (the None and SolidColor modes, the warnings)
+     * are rasterised here if their settings changed and left out of the plan. A black solid
+     * background is left empty, uncovered LED's are black anyway. The other layers get one step
+     * with the runner of their mode.
+     */
+    void compile_plan();
+
+    /**
+     * @brief Append a step to the render plan
+     */
+    void add_step(void (PLedDisp::*run)(const PlanStep &, uint8_t), void (PLedDisp::*draw)(), PLedCompositor::Layer layer);
+
+    /**
+     * @brief Runner of effects drawing each animation step from scratch
+     *
+     * @param step - Plan step with the effect
+     * @param steps - Nbr of animation steps since the last update, the content of the last one is shown
+     */
+    void run_animation(const PlanStep &step, uint8_t steps);
+
+    /**
+     * @brief Runner of effects drawing each animation step onto the content of the last one
+     */
+    void run_steps(const PlanStep &step, uint8_t steps);
+
+    /**
+     * @brief Runner of ModeBG::ScrollingRainbow, rasterised when the gradient moved
+     */
+    void run_rainbow(const PlanStep &step, uint8_t steps);
+
+    /**
+     * @brief Runner of ModeFR::Time, rasterised every second
+     */
+    void run_frame_time(const PlanStep &step, uint8_t steps);
+
+    /**
+     * @brief Runner of ModeFG::Time and ModeFG::TimeRainbow, rasterised when the digits, the
+     * seconds tick or the hue changed
+     */
+    void run_time(const PlanStep &step, uint8_t steps);
+
+    /**
+     * @brief Runner of ModeFG::Cycle, one number per animation step
+     */
+    void run_cycle(const PlanStep &step, uint8_t steps);
+
+#ifdef PLED_SCROLLING_TEXT
+    /**
+     * @brief Runner of ModeFG::Text, rasterised when the text moved by a column
+     */
+    void run_text(const PlanStep &step, uint8_t steps);
+#endif
+
+    /**
+     * @brief Runner of ModeFG::Label, rasterised when the label was laid out anew
+     */
+    void run_label(const PlanStep &step, uint8_t steps);
+
+#ifndef PLED_DIRECT_LAYERS
+    /**
+     * @brief Rasterise the overlay layer with the warnings
+     */
+    void update_overlay();
+#endif
+
+    /**
+     * @brief Pick the shading kernel of the foreground for its mode and shade
+     */
+    void update_shader();
+
+    /**
+     * @brief Set the palettes of the layers for the modes and colours, only with PLED_INDEXED_COLOR
+     */
+    void update_palettes();
 
     /**
      * @brief Display time in foreground
@@ -265,6 +683,26 @@ class PLedDisp {
      */
     void disp_time(DateTime &time, Foreground &fg);
 
+    /**
+     * @brief Display a digit of the time in foreground, morphing from the last one
+     *
+     * @param digit - 0--9
+     * @param glyph - Digit of the time 0--3 from the left
+     * @param slot - Slot of the digit, see PLedGeometry::TIME_SLOTS
+     * @param fg - Foregroundsettings
+     */
+    void disp_digit(uint8_t digit, uint8_t glyph, uint8_t slot, Foreground &fg);
+
+#ifdef PLED_COVERAGE
+    /**
+     * @brief Advance the morphs of the time digits
+     *
+     * @param steps - Nbr of animation steps since the last update
+     * @return true - A digit morphed, the foreground has to be drawn again
+     */
+    bool advance_morphs(uint8_t steps);
+#endif
+
     /**
      * @brief Display 4 digits in foreground
      *
@@ -277,23 +715,32 @@ class PLedDisp {
     void disp_number(uint8_t Digit3, uint8_t Digit2, uint8_t Digit1, uint8_t Digit0, Foreground &fg);
 
     /**
-     * @brief Display a digit
+     * @brief Display LED's in foreground with the shading kernel
      *
-     * @param num - Number to display
-     * @param offset - Offset to first LED
+     * @param mask - LED's of one glyph
      * @param fg - Foregroundsettings
+     * @param glyph - Digit 0--3 from the left or PLedShade::GLYPH_COLON
      */
-    void disp_digit(int num, int offset, Foreground &fg);
+    void disp_mask(const LedMask &mask, Foreground &fg, uint8_t glyph);
 
+#ifdef PLED_COVERAGE
     /**
-     * @brief Get color for LED on this index
+     * @brief Let the LED's of the foreground drawn partly cover the layers below
      *
-     * @param indx - Address of LED
-     * @param fg - Foregroundsettings
-     * @return CRGB - Color to return
+     * @param mask - LED's drawn
+     * @param cover - Coverage per LED address, added up by PLedSubpixel
      */
-    CRGB fg_palette(int indx, Foreground &fg);
+    void cover_mask(const LedMask &mask, const uint8_t *cover);
+#endif
 
+    /**
+     * @brief Nbr of frame LED's lit by the second hand
+     *
+     * @param time - actual time to display
+     */
+    uint8_t frame_length(DateTime &time);
+
+#ifndef PLED_DIRECT_LAYERS
     /**
      * @brief Display frame as solod color
      *
@@ -308,6 +755,7 @@ class PLedDisp {
      * @param fr - Framesettings containg color
      */
     void fr_time(DateTime &time, Frame &fr);
+#endif
 
     /**
      * @brief Display background in one solid color
@@ -317,7 +765,7 @@ class PLedDisp {
     void bg_solidColor(Background &bg);
 
     /**
-     * @brief Display background as rainbow color
+     * @brief Display background as rainbow color, every LED shows the next hue of rainbowScroll
      **/
     void bg_rainbow();
 
@@ -337,7 +785,41 @@ class PLedDisp {
     void bg_firework();
 
     /**
-     * @brief Display background as firepit
+     * @brief Display background as firepit, a heat-diffusion fire rising from the bottom row
      **/
     void bg_firepit();
+
+    /**
+     * @brief Display the next step of the animation clip on the last one, starts a clip set before
+     **/
+    void bg_clip();
+
+    /**
+     * @brief Display background with the bytecode program
+     **/
+    void bg_program();
+
+    /**
+     * @brief Draw and advance a twinkle
+     *
+     * @param i - Slot in twinkles
+     * @return true - Twinkle still alive
+     */
+    bool update_twinkle(uint8_t i);
+
+    /**
+     * @brief Draw and advance a raindrop or lightning
+     *
+     * @param i - Slot in raindrops
+     * @return true - Raindrop still alive
+     */
+    bool update_raindrop(uint8_t i);
+
+    /**
+     * @brief Draw and advance a firework
+     *
+     * @param i - Slot in fireworks
+     * @return true - Firework still alive
+     */
+    bool update_firework(uint8_t i);
 };
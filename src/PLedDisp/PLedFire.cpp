@@ -0,0 +1,59 @@
+/**
+ * @file PLedFire.cpp
+ * @date 2026-10-15
+ *
+ */
+
+#include "PLedFire.h"
+
+void PLedFire::step(PLedLayer &layer, PLedRandom &rng) {
+    using namespace PLedGeometry;
+
+#ifdef PLED_INDEXED_COLOR
+    // The heat is kept in the layer, LED's without heat were left uncovered
+    uint8_t *heat = layer.px;
+    for (uint8_t led = 0; led < LED_COUNT; led++) {
+        if (!layer.mask.test(led)) {
+            heat[led] = 0;
+        }
+    }
+#endif
+
+    // Top down, so every LED sees the heat of the LED's below from the last step
+    for (uint8_t row = 0; row < ROWS - 1; row++) {
+        for (uint8_t col = 0; col < COLS; col++) {
+            uint8_t led = address(row, col);
+            if (led == NO_LED) {
+                continue;
+            }
+            uint8_t below = neighbour(led, 3);
+            uint8_t belowLeft = neighbour(led, 4);
+            uint8_t cooled = qsub8(heat[led], rng.random8(COOLING + (ROWS - 1 - row) * COOLING_RISE));
+            heat[led] = (cooled + 3 * heat[below] + 3 * heat[belowLeft]) >> 3;
+        }
+    }
+    // The bottom row only cools and gets the sparks
+    for (uint8_t col = 0; col < COLS; col++) {
+        uint8_t led = address(ROWS - 1, col);
+        heat[led] = qsub8(heat[led], rng.random8(COOLING));
+    }
+    heat[SINK] = 0;
+
+    for (uint8_t i = 0; i < SPARKS; i++) {
+        if (rng.random8() < SPARKING) {
+            uint8_t led = address(ROWS - 1, rng.random8(SPARK_FIRST_COL, SPARK_LAST_COL + 1));
+            heat[led] = qadd8(heat[led], rng.random8(SPARK_MIN, 255));
+        }
+    }
+
+    layer.begin();
+    for (uint8_t led = 0; led < LED_COUNT; led++) {
+        if (heat[led] != 0) {
+#ifdef PLED_INDEXED_COLOR
+            layer.putIndex(led, heat[led]);  // Layer palette is HeatColors_p
+#else
+            layer.put(led, heatColor(heat[led]));
+#endif
+        }
+    }
+}
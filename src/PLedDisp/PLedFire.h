@@ -0,0 +1,85 @@
+/**
+ * @file PLedFire.h
+ * @brief Heat-diffusion fire on the hexagonal lattice
+ *
+ * Every LED holds a heat value. Each step the heat cools down, rises from the two LED's below
+ * (convection) and new sparks ignite in the bottom row. The heat is shown through a heat
+ * palette black - red - yellow - white, generated at compile time into flash.
+ * Everything is 8/16 bit fixed point. With PLED_INDEXED_COLOR the heat is the palette index of
+ * the layer drawn on (HeatColors_p), the fire keeps no buffer of its own.
+ *
+ * @date 2026-10-15
+ */
+
+#pragma once
+
+#include <FastLED.h>
+
+#include "PLedCompositor.h"
+#include "PLedGeometry.h"
+#include "PLedRandom.h"
+
+namespace PLedFirePalette {
+struct Table {
+    uint8_t rgb[256][3];
+};
+
+/**
+ * @brief Heat palette like FastLED's HeatColor(): black - red - yellow - white
+ */
+constexpr Table makeTable() {
+    Table table = {};
+    for (int heat = 0; heat < 256; heat++) {
+        uint8_t t192 = ((heat * 191) >> 8) + ((heat != 0) ? 1 : 0);  // scale8_video(heat, 191)
+        uint8_t ramp = (t192 & 0x3F) << 2;
+        if (t192 & 0x80) {  // hottest
+            table.rgb[heat][0] = 255;
+            table.rgb[heat][1] = 255;
+            table.rgb[heat][2] = ramp;
+        } else if (t192 & 0x40) {  // middle
+            table.rgb[heat][0] = 255;
+            table.rgb[heat][1] = ramp;
+        } else {  // coolest
+            table.rgb[heat][0] = ramp;
+        }
+    }
+    return table;
+}
+
+inline constexpr Table HEAT PLED_FLASH = makeTable();
+}  // namespace PLedFirePalette
+
+class PLedFire {
+   public:
+    static const uint8_t COOLING = 40;       // Max. heat lost per step in the bottom row
+    static const uint8_t COOLING_RISE = 24;  // Additional max. heat lost per row above the bottom
+    static const uint8_t SPARKS = 4;         // Max. nbr of new sparks per step
+    static const uint8_t SPARKING = 128;     // Chance of each spark, x/256
+    static const uint8_t SPARK_MIN = 160;    // Min. heat of a new spark
+    static constexpr uint8_t SPARK_FIRST_COL = PLedGeometry::firstCol(PLedGeometry::ROWS - 1);  // Bottom row
+    static constexpr uint8_t SPARK_LAST_COL = PLedGeometry::lastCol(PLedGeometry::ROWS - 1);
+
+    /**
+     * @brief Advance the fire by one step and draw all LED's with heat
+     *
+     * @param layer - Layer to draw on, with PLED_INDEXED_COLOR its LED's not covered are cold
+     * @param rng - Random numbers for cooling and sparks
+     */
+    void step(PLedLayer &layer, PLedRandom &rng);
+
+    /**
+     * @brief Colour of a heat value
+     *
+     * @param heat - 0--255
+     */
+    static inline CRGB heatColor(uint8_t heat) {
+        return CRGB(PLED_READ_BYTE(&PLedFirePalette::HEAT.rgb[heat][0]),
+                    PLED_READ_BYTE(&PLedFirePalette::HEAT.rgb[heat][1]),
+                    PLED_READ_BYTE(&PLedFirePalette::HEAT.rgb[heat][2]));
+    }
+
+#ifndef PLED_INDEXED_COLOR
+   private:
+    uint8_t heat[PLedGeometry::LED_COUNT + 1] = {};  // Last entry is the sink, always cold
+#endif
+};
@@ -0,0 +1,541 @@
+/**
+ * @file PLedGeometry.h
+ * @brief Geometry of the PingPong display: LED addresses, digits, frame and warning LED's
+ *
+ * All tables are generated at compile time from the wiring of the strip and stored in flash
+ * (PROGMEM on AVR), so they cost no RAM. Read them through the accessors, on AVR a plain
+ * array access would read from RAM at the flash address.
+ *
+ * @date 2026-10-15
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#include "LedMask.h"
+
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#define PLED_FLASH PROGMEM
+#define PLED_READ_BYTE(addr) pgm_read_byte(addr)
+#define PLED_READ_BLOCK(dst, src, size) memcpy_P(dst, src, size)
+#else
+#define PLED_FLASH
+#define PLED_READ_BYTE(addr) (*(const uint8_t *)(addr))
+#define PLED_READ_BLOCK(dst, src, size) memcpy(dst, src, size)
+#endif
+
+namespace PLedGeometry {
+
+const uint8_t ROWS = 7;              // Rows of the lattice
+const uint8_t COLS = 20;             // Columns of the lattice
+const uint8_t LED_COUNT = 128;       // Nbr of LED's on the strip
+const uint8_t SINK = LED_COUNT;      // Index after the last LED, absorbs writes to missing LED's
+const uint8_t NO_LED = SINK;         // Lattice position without LED
+const uint8_t DIGIT_MAX_LEDS = 13;   // Max. nbr of LED's of one digit
+const uint8_t FRAME_LENGTH = 44;     // Nbr of LED's around the border
+const uint8_t FRAME_START_COL = 11;  // Frame starts top center, like a clock hand
+const uint8_t WARNING_COUNT = 4;     // Nbr of warning LED's bottom right
+
+/**
+ * Imagining the display as a parallelogram slanted to the left,
+ * Figure 9 becomes a two dimensional array (look up table) with values corresponding to the strip index.
+ * For the positions that don't exist, the value is NO_LED. Buffers indexed by LED address have
+ * LED_COUNT + 1 entries, so writing to NO_LED is harmless and needs no check.
+ *
+ *        / 012 013 ...
+ *      / 001 011   ...
+ *    / 002 010 015 ...
+ *  < 000 003 009   ...
+ *    \ 004 008 017 ...
+ *      \ 005 007   ...
+ *        \ 006 019 ...
+ *
+ * The strip starts with 6 LED's at the left tip, then runs in zigzag over the lattice:
+ * 7 LED's up from row 6 to row 0, 7 LED's down from row 0 to row 6, each run one column
+ * further right. The last 3 LED's fill the right tip.
+ */
+struct Position {
+    uint8_t row;
+    uint8_t col;
+};
+
+const uint8_t HEAD_LEDS = 6;   // LED's of the left tip
+const uint8_t RUN_LEDS = 7;    // LED's per zigzag run
+const uint8_t RUN_COUNT = 17;  // Nbr of zigzag runs
+constexpr Position HEAD[HEAD_LEDS] = {{3, 0}, {1, 2}, {2, 1}, {3, 1}, {4, 0}, {5, 0}};
+constexpr Position TAIL[] = {{2, 19}, {3, 19}, {4, 18}};
+
+/**
+ * @brief Position of a LED on the lattice according to the wiring
+ *
+ * @param led - Strip index 0--127
+ * @return Position - Row and column
+ */
+constexpr Position wiring(uint8_t led) {
+    if (led < HEAD_LEDS) {
+        return HEAD[led];
+    }
+    uint8_t run = (led - HEAD_LEDS) / RUN_LEDS;
+    uint8_t j = (led - HEAD_LEDS) % RUN_LEDS;
+    if (run >= RUN_COUNT) {
+        return TAIL[led - HEAD_LEDS - RUN_COUNT * RUN_LEDS];
+    }
+    if (run % 2 == 0) {
+        return {uint8_t(ROWS - 1 - j), uint8_t(run + (j + 1) / 2)};  // up
+    }
+    return {j, uint8_t(run + 3 - j / 2)};  // down
+}
+
+struct AddressTable {
+    uint8_t at[ROWS][COLS];
+};
+
+constexpr AddressTable makeAddressTable() {
+    AddressTable table = {};
+    for (uint8_t row = 0; row < ROWS; row++) {
+        for (uint8_t col = 0; col < COLS; col++) {
+            table.at[row][col] = NO_LED;
+        }
+    }
+    for (uint8_t led = 0; led < LED_COUNT; led++) {
+        Position pos = wiring(led);
+        table.at[pos.row][pos.col] = led;
+    }
+    return table;
+}
+
+inline constexpr AddressTable ADDRESS PLED_FLASH = makeAddressTable();
+
+struct RowTable {
+    uint8_t row[LED_COUNT + 1];  // Also for the SINK, in row 0
+};
+
+constexpr RowTable makeRowTable() {
+    RowTable table = {};
+    for (uint8_t led = 0; led < LED_COUNT; led++) {
+        table.row[led] = wiring(led).row;
+    }
+    return table;
+}
+
+inline constexpr RowTable ROW PLED_FLASH = makeRowTable();
+
+/**
+ * @brief Strip index of a lattice position, positions outside the lattice have no LED
+ *
+ * @param row - Any row
+ * @param col - Any column
+ * @return uint8_t - LED address or NO_LED
+ */
+constexpr uint8_t latticeAddress(int row, int col) {
+    if ((row < 0) || (row >= ROWS) || (col < 0) || (col >= COLS)) {
+        return NO_LED;
+    }
+    return ADDRESS.at[row][col];
+}
+
+/** NEIGHBOURS **/
+// Hexagonal neighbourhood on the slanted lattice as {row, col} offsets, clockwise.
+// Ring 2 starts with the same direction, the corners of the ring are NEIGHBOUR_OFFSETS * 2 at even indices.
+const uint8_t NEIGHBOURS = 6;  // Nbr of direct neighbours
+const uint8_t RING2 = 12;      // Nbr of LED's at distance 2
+constexpr int8_t NEIGHBOUR_OFFSETS[NEIGHBOURS][2] = {{-1, 0}, {-1, 1}, {0, 1}, {1, 0}, {1, -1}, {0, -1}};
+constexpr int8_t RING2_OFFSETS[RING2][2] = {{-2, 0}, {-2, 1}, {-2, 2}, {-1, 2}, {0, 2}, {1, 1},
+                                            {2, 0}, {2, -1}, {2, -2}, {1, -2}, {0, -2}, {-1, -1}};
+
+struct NeighbourTable {
+    uint8_t next[LED_COUNT + 1][NEIGHBOURS];  // Also for the SINK, which only has SINK as neighbours
+    uint8_t ring2[LED_COUNT + 1][RING2];
+};
+
+constexpr NeighbourTable makeNeighbourTable() {
+    NeighbourTable table = {};
+    for (uint8_t i = 0; i < NEIGHBOURS; i++) {
+        table.next[SINK][i] = SINK;
+    }
+    for (uint8_t i = 0; i < RING2; i++) {
+        table.ring2[SINK][i] = SINK;
+    }
+    for (uint8_t led = 0; led < LED_COUNT; led++) {
+        Position pos = wiring(led);
+        for (uint8_t i = 0; i < NEIGHBOURS; i++) {
+            table.next[led][i] = latticeAddress(pos.row + NEIGHBOUR_OFFSETS[i][0], pos.col + NEIGHBOUR_OFFSETS[i][1]);
+        }
+        for (uint8_t i = 0; i < RING2; i++) {
+            table.ring2[led][i] = latticeAddress(pos.row + RING2_OFFSETS[i][0], pos.col + RING2_OFFSETS[i][1]);
+        }
+    }
+    return table;
+}
+
+inline constexpr NeighbourTable NEIGHBOUR PLED_FLASH = makeNeighbourTable();
+
+/** DIGITS **/
+// Look up tables for how to build alphanumeric characters, 0 terminated
+// referenced from leftmost
+constexpr uint8_t DIGIT_LEDS[10][DIGIT_MAX_LEDS] = {
+    {7, 8, 10, 11, 14, 18, 22, 24},         // 0
+    {14, 15, 16, 17, 18},                   // 1
+    {7, 8, 9, 11, 14, 16, 18, 24},          // 2
+    {7, 9, 11, 14, 16, 18, 22, 24},         // 3
+    {9, 10, 11, 16, 18, 22, 24},            // 4
+    {7, 9, 10, 11, 14, 16, 18, 22},         // 5
+    {7, 8, 9, 14, 15, 16, 18, 22},          // 6
+    {7, 11, 14, 16, 17, 24},                // 7
+    {7, 8, 9, 10, 11, 14, 16, 18, 22, 24},  // 8
+    {7, 9, 10, 11, 14, 16, 17, 24},         // 9
+};
+
+// referenced from one place to the right because not all digits will fit at leftmost
+constexpr uint8_t SLANT_DIGIT_LEDS[10][DIGIT_MAX_LEDS] = {
+    {39, 42, 53, 52, 44, 45, 35, 32, 21, 31, 30, 38},      // 0
+    {35, 45, 44, 52, 53},                                  // 1
+    {39, 42, 53, 52, 44, 37, 30, 31, 21, 32, 35},          // 2
+    {39, 42, 53, 52, 44, 37, 30, 45, 35, 32, 21},          // 3
+    {39, 38, 30, 37, 44, 52, 53, 45, 35},                  // 4
+    {53, 42, 39, 38, 30, 37, 44, 45, 35, 32, 21},          // 5
+    {53, 42, 39, 38, 30, 37, 44, 45, 35, 32, 21, 31},      // 6
+    {39, 42, 53, 52, 44, 45, 35, 38},                      // 7
+    {53, 42, 39, 38, 30, 37, 44, 45, 35, 32, 21, 31, 52},  // 8
+    {53, 42, 39, 38, 30, 37, 44, 45, 35, 32, 21, 52},      // 9
+};
+const int SLANT_DIGIT_OFFSET = -28;  // Slanted digits are referenced one place to the right
+
+struct GlyphTable {
+    uint8_t led[10][DIGIT_MAX_LEDS];
+    uint8_t len[10];
+};
+
+constexpr GlyphTable makeGlyphTable(const uint8_t (&leds)[10][DIGIT_MAX_LEDS]) {
+    GlyphTable table = {};
+    for (uint8_t num = 0; num < 10; num++) {
+        for (uint8_t i = 0; i < DIGIT_MAX_LEDS; i++) {
+            table.led[num][i] = leds[num][i];
+            if (leds[num][i] != 0) {
+                table.len[num] = i + 1;
+            }
+        }
+    }
+    return table;
+}
+
+inline constexpr GlyphTable DIGITS PLED_FLASH = makeGlyphTable(DIGIT_LEDS);
+inline constexpr GlyphTable SLANT_DIGITS PLED_FLASH = makeGlyphTable(SLANT_DIGIT_LEDS);
+
+/** GLYPH MASKS **/
+// Strip offsets where digits are placed: time uses 0/28/70/98, numbers 14/42/70/98
+const uint8_t SLOT_COUNT = 6;
+constexpr uint8_t SLOT_OFFSETS[SLOT_COUNT] = {0, 14, 28, 42, 70, 98};
+const uint8_t TIME_SLOTS[4] = {0, 2, 4, 5};    // Slots of the time digits from left to right
+const uint8_t NUMBER_SLOTS[4] = {1, 3, 4, 5};  // Slots of the number digits from left to right
+
+const uint8_t COLON_UPPER_LED = 66;        // Upper dot of the seconds tick
+const uint8_t COLON_LOWER_LED = 64;        // Lower dot of the seconds tick
+const uint8_t COLON_LOWER_SLANT_LED = 59;  // Lower dot of the seconds tick, slanted digits
+
+/**
+ * @brief Place a LED of DIGIT_LEDS or SLANT_DIGIT_LEDS at a strip offset
+ *
+ * @param led - LED of the digit table
+ * @param offset - Strip offset of the digit
+ * @param slanted - LED of SLANT_DIGIT_LEDS
+ * @return uint8_t - LED address or NO_LED
+ */
+constexpr uint8_t placeDigitLed(uint8_t led, int offset, bool slanted) {
+    int indx = led + offset;
+    if (slanted) {
+        indx += SLANT_DIGIT_OFFSET;
+        if (indx < 7)
+            indx++;  // adjust when LEDS really close to the start of the strip
+    }
+    return (indx >= 0 && indx < LED_COUNT) ? indx : NO_LED;
+}
+
+/**
+ * @brief LED's of a digit placed at a strip offset
+ *
+ * @param num - Digit 0--9
+ * @param offset - Strip offset of the digit
+ * @param slanted - Slanted/italic or upright digit
+ * @return LedMask - LED's of the digit
+ */
+constexpr LedMask makeGlyphMask(uint8_t num, int offset, bool slanted) {
+    const GlyphTable &glyphs = slanted ? SLANT_DIGITS : DIGITS;
+    LedMask mask;
+    for (uint8_t i = 0; i < glyphs.len[num]; i++) {
+        uint8_t indx = placeDigitLed(glyphs.led[num][i], offset, slanted);
+        if (indx != NO_LED)
+            mask.set(indx);
+    }
+    return mask;
+}
+
+struct GlyphMaskTable {
+    LedMask mask[2][10][SLOT_COUNT];  // [slanted][digit][slot]
+    LedMask colon[2];                 // [slanted]
+};
+
+constexpr GlyphMaskTable makeGlyphMaskTable() {
+    GlyphMaskTable table = {};
+    for (uint8_t slanted = 0; slanted < 2; slanted++) {
+        for (uint8_t num = 0; num < 10; num++) {
+            for (uint8_t slot = 0; slot < SLOT_COUNT; slot++) {
+                table.mask[slanted][num][slot] = makeGlyphMask(num, SLOT_OFFSETS[slot], slanted);
+            }
+        }
+        table.colon[slanted].set(COLON_UPPER_LED);
+        table.colon[slanted].set(slanted ? COLON_LOWER_SLANT_LED : COLON_LOWER_LED);
+    }
+    return table;
+}
+
+inline constexpr GlyphMaskTable GLYPH_MASKS PLED_FLASH = makeGlyphMaskTable();
+
+/** MORPHS **/
+// LED's leaving and joining a digit when it changes to another one, for all 10x10 changes of both
+// styles. Digit relative like DIGIT_LEDS, placed with placeDigitLed().
+const uint8_t MORPH_MAX_LEDS = 2 * DIGIT_MAX_LEDS;
+
+struct MorphTable {
+    uint8_t led[2][10][10][MORPH_MAX_LEDS];  // [slanted][from][to], the leaving LED's first, then the joining ones
+    uint8_t leaving[2][10][10];
+    uint8_t joining[2][10][10];
+};
+
+constexpr bool glyphHas(const GlyphTable &glyphs, uint8_t num, uint8_t led) {
+    for (uint8_t i = 0; i < glyphs.len[num]; i++) {
+        if (glyphs.led[num][i] == led) {
+            return true;
+        }
+    }
+    return false;
+}
+
+constexpr MorphTable makeMorphTable() {
+    MorphTable table = {};
+    for (uint8_t slanted = 0; slanted < 2; slanted++) {
+        const GlyphTable &glyphs = slanted ? SLANT_DIGITS : DIGITS;
+        for (uint8_t from = 0; from < 10; from++) {
+            for (uint8_t to = 0; to < 10; to++) {
+                uint8_t n = 0;
+                for (uint8_t i = 0; i < glyphs.len[from]; i++) {
+                    if (!glyphHas(glyphs, to, glyphs.led[from][i])) {
+                        table.led[slanted][from][to][n++] = glyphs.led[from][i];
+                    }
+                }
+                table.leaving[slanted][from][to] = n;
+                for (uint8_t i = 0; i < glyphs.len[to]; i++) {
+                    if (!glyphHas(glyphs, from, glyphs.led[to][i])) {
+                        table.led[slanted][from][to][n++] = glyphs.led[to][i];
+                    }
+                }
+                table.joining[slanted][from][to] = n - table.leaving[slanted][from][to];
+            }
+        }
+    }
+    return table;
+}
+
+inline constexpr MorphTable MORPHS PLED_FLASH = makeMorphTable();
+
+/** FRAME **/
+constexpr uint8_t firstCol(uint8_t row) {
+    uint8_t col = 0;
+    while (ADDRESS.at[row][col] == NO_LED) {
+        col++;
+    }
+    return col;
+}
+
+constexpr uint8_t lastCol(uint8_t row) {
+    uint8_t col = COLS - 1;
+    while (ADDRESS.at[row][col] == NO_LED) {
+        col--;
+    }
+    return col;
+}
+
+struct LedList {
+    uint8_t led[FRAME_LENGTH];
+};
+
+// Border of the lattice clockwise, starting top center
+constexpr LedList makeFrame() {
+    LedList frame = {};
+    uint8_t n = 0;
+    for (uint8_t col = FRAME_START_COL; col < COLS; col++) {  // top, right half
+        frame.led[n++] = ADDRESS.at[0][col];
+    }
+    for (uint8_t row = 1; row < ROWS; row++) {  // right edge
+        frame.led[n++] = ADDRESS.at[row][lastCol(row)];
+    }
+    for (int col = lastCol(ROWS - 1) - 1; col >= 0; col--) {  // bottom
+        frame.led[n++] = ADDRESS.at[ROWS - 1][col];
+    }
+    for (int row = ROWS - 2; row > 0; row--) {  // left edge
+        frame.led[n++] = ADDRESS.at[row][firstCol(row)];
+    }
+    for (uint8_t col = firstCol(0); col < FRAME_START_COL; col++) {  // top, left half
+        frame.led[n++] = ADDRESS.at[0][col];
+    }
+    return frame;
+}
+
+inline constexpr LedList FRAME PLED_FLASH = makeFrame();
+
+// Warning LED's: right edge of the bottom rows
+constexpr LedList makeWarnings() {
+    LedList warnings = {};
+    for (uint8_t i = 0; i < WARNING_COUNT; i++) {
+        uint8_t row = ROWS - 1 - i;
+        warnings.led[i] = ADDRESS.at[row][lastCol(row)];
+    }
+    return warnings;
+}
+
+inline constexpr LedList WARNINGS PLED_FLASH = makeWarnings();
+
+//=====ACCESSORS=================================================================================
+/**
+ * @brief Strip index of a lattice position
+ *
+ * @param row - 0--6
+ * @param col - 0--19
+ * @return uint8_t - LED address or NO_LED
+ */
+inline uint8_t address(uint8_t row, uint8_t col) {
+    return PLED_READ_BYTE(&ADDRESS.at[row][col]);
+}
+
+/**
+ * @brief Row of a LED
+ *
+ * @param led - LED address 0--LED_COUNT-1 or SINK
+ * @return uint8_t - 0--6
+ */
+inline uint8_t row(uint8_t led) {
+    return PLED_READ_BYTE(&ROW.row[led]);
+}
+
+/**
+ * @brief Direct neighbour of a LED on the hexagonal lattice
+ *
+ * @param led - LED address 0--LED_COUNT-1 or SINK
+ * @param dir - 0--NEIGHBOURS-1, see NEIGHBOUR_OFFSETS
+ * @return uint8_t - LED address or NO_LED at the border
+ */
+inline uint8_t neighbour(uint8_t led, uint8_t dir) {
+    return PLED_READ_BYTE(&NEIGHBOUR.next[led][dir]);
+}
+
+/**
+ * @brief LED at distance 2 on the hexagonal lattice
+ *
+ * @param led - LED address 0--LED_COUNT-1 or SINK
+ * @param i - 0--RING2-1, see RING2_OFFSETS
+ * @return uint8_t - LED address or NO_LED at the border
+ */
+inline uint8_t ring2(uint8_t led, uint8_t i) {
+    return PLED_READ_BYTE(&NEIGHBOUR.ring2[led][i]);
+}
+
+/**
+ * @brief LED of a digit
+ *
+ * @param num - Digit 0--9
+ * @param i - 0--digitLength(num)-1
+ * @param slanted - Slanted/italic or upright digit
+ * @return uint8_t - LED address of a digit at offset 0 (slanted: one place to the right)
+ */
+inline uint8_t digitLed(uint8_t num, uint8_t i, bool slanted) {
+    return PLED_READ_BYTE(slanted ? &SLANT_DIGITS.led[num][i] : &DIGITS.led[num][i]);
+}
+
+/**
+ * @brief Nbr of LED's of a digit
+ *
+ * @param num - Digit 0--9
+ * @param slanted - Slanted/italic or upright digit
+ */
+inline uint8_t digitLength(uint8_t num, bool slanted) {
+    return PLED_READ_BYTE(slanted ? &SLANT_DIGITS.len[num] : &DIGITS.len[num]);
+}
+
+/**
+ * @brief LED's of a digit in one of the digit slots
+ *
+ * @param num - Digit 0--9
+ * @param slot - 0--SLOT_COUNT-1, see SLOT_OFFSETS
+ * @param slanted - Slanted/italic or upright digit
+ */
+inline LedMask glyphMask(uint8_t num, uint8_t slot, bool slanted) {
+    LedMask mask;
+    PLED_READ_BLOCK(&mask, &GLYPH_MASKS.mask[slanted][num][slot], sizeof(LedMask));
+    return mask;
+}
+
+/**
+ * @brief Nbr of LED's leaving a digit when it changes
+ *
+ * @param from - Digit 0--9 shown
+ * @param to - Digit 0--9 shown next
+ * @param slanted - Slanted/italic or upright digits
+ */
+inline uint8_t morphLeaving(uint8_t from, uint8_t to, bool slanted) {
+    return PLED_READ_BYTE(&MORPHS.leaving[slanted][from][to]);
+}
+
+/**
+ * @brief Nbr of LED's joining a digit when it changes
+ */
+inline uint8_t morphJoining(uint8_t from, uint8_t to, bool slanted) {
+    return PLED_READ_BYTE(&MORPHS.joining[slanted][from][to]);
+}
+
+/**
+ * @brief LED changing when a digit in one of the digit slots changes
+ *
+ * @param from - Digit 0--9 shown
+ * @param to - Digit 0--9 shown next
+ * @param i - 0--morphLeaving()-1 for the leaving LED's, then the joining ones
+ * @param slot - 0--SLOT_COUNT-1, see SLOT_OFFSETS
+ * @param slanted - Slanted/italic or upright digits
+ * @return uint8_t - LED address or NO_LED
+ */
+inline uint8_t morphLed(uint8_t from, uint8_t to, uint8_t i, uint8_t slot, bool slanted) {
+    return placeDigitLed(PLED_READ_BYTE(&MORPHS.led[slanted][from][to][i]), SLOT_OFFSETS[slot], slanted);
+}
+
+/**
+ * @brief LED's of the seconds tick ":" between the hours and minutes
+ *
+ * @param slanted - Slanted/italic or upright digits
+ */
+inline LedMask colonMask(bool slanted) {
+    LedMask mask;
+    PLED_READ_BLOCK(&mask, &GLYPH_MASKS.colon[slanted], sizeof(LedMask));
+    return mask;
+}
+
+/**
+ * @brief LED of the frame, clockwise starting top center
+ *
+ * @param i - 0--FRAME_LENGTH-1
+ */
+inline uint8_t frame(uint8_t i) {
+    return PLED_READ_BYTE(&FRAME.led[i]);
+}
+
+/**
+ * @brief LED of a warning indicator
+ *
+ * @param i - 0--WARNING_COUNT-1
+ */
+inline uint8_t warning(uint8_t i) {
+    return PLED_READ_BYTE(&WARNINGS.led[i]);
+}
+
+}  // namespace PLedGeometry
@@ -0,0 +1,251 @@
+/**
+ * @file PLedLayout.cpp
+ * @date 2026-10-16
+ *
+ */
+
+#include "PLedLayout.h"
+
+#include <string.h>
+
+namespace {
+
+using PLedGeometry::NO_LED;
+
+const uint8_t NO_GLYPH = 0xFF;  // Blank, a space or a character without glyph
+const uint8_t DIGIT_GLYPHS = 10;
+const uint8_t GLYPH_COUNT = 32;
+const char CHARS[GLYPH_COUNT + 1] PLED_FLASH = "0123456789ABCDEFHLNOPRSTUY-+`:./";  // Index of the glyph
+
+// 3x5 pixel font of the characters after the digits, one byte per row from the top, bit 2 is the
+// left pixel. The rows are the rows 1--5 of the lattice, as the digits.
+const uint8_t FONT_TOP_ROW = 1;
+const uint8_t FONT_HEIGHT = 5;
+const uint8_t FONT_WIDTH = 3;
+constexpr uint8_t FONT[GLYPH_COUNT - DIGIT_GLYPHS][FONT_HEIGHT] = {
+    {0x2, 0x5, 0x7, 0x5, 0x5},  // A
+    {0x6, 0x5, 0x6, 0x5, 0x6},  // B
+    {0x3, 0x4, 0x4, 0x4, 0x3},  // C
+    {0x6, 0x5, 0x5, 0x5, 0x6},  // D
+    {0x7, 0x4, 0x6, 0x4, 0x7},  // E
+    {0x7, 0x4, 0x6, 0x4, 0x4},  // F
+    {0x5, 0x5, 0x7, 0x5, 0x5},  // H
+    {0x4, 0x4, 0x4, 0x4, 0x7},  // L
+    {0x0, 0x6, 0x5, 0x5, 0x5},  // N, small n
+    {0x7, 0x5, 0x5, 0x5, 0x7},  // O
+    {0x6, 0x5, 0x6, 0x4, 0x4},  // P
+    {0x6, 0x5, 0x6, 0x5, 0x5},  // R
+    {0x3, 0x4, 0x2, 0x1, 0x6},  // S
+    {0x7, 0x2, 0x2, 0x2, 0x2},  // T
+    {0x5, 0x5, 0x5, 0x5, 0x7},  // U
+    {0x5, 0x5, 0x2, 0x2, 0x2},  // Y
+    {0x0, 0x0, 0x7, 0x0, 0x0},  // -
+    {0x0, 0x2, 0x7, 0x2, 0x0},  // +
+    {0x6, 0x6, 0x0, 0x0, 0x0},  // degree sign instead of `
+    {0x0, 0x2, 0x0, 0x2, 0x0},  // :
+    {0x0, 0x0, 0x0, 0x0, 0x2},  // .
+    {0x1, 0x1, 0x2, 0x4, 0x4},  // /
+};
+
+struct GlyphTable {
+    uint8_t col[2][GLYPH_COUNT][PLedLayout::GLYPH_COLS];  // [slanted][glyph], bit r is row r
+    uint8_t width[2][GLYPH_COUNT];
+};
+
+/**
+ * @brief Lattice columns of a glyph, starting at its leftmost lit column
+ */
+constexpr void makeGlyph(GlyphTable &table, bool slanted, uint8_t glyph) {
+    uint8_t cols[PLedGeometry::COLS] = {};
+    if (glyph < DIGIT_GLYPHS) {
+        const PLedGeometry::GlyphTable &digits = slanted ? PLedGeometry::SLANT_DIGITS : PLedGeometry::DIGITS;
+        for (uint8_t i = 0; i < digits.len[glyph]; i++) {
+            PLedGeometry::Position pos = PLedGeometry::wiring(digits.led[glyph][i]);
+            cols[pos.col] |= 1 << pos.row;
+        }
+    } else {
+        for (uint8_t y = 0; y < FONT_HEIGHT; y++) {
+            for (uint8_t x = 0; x < FONT_WIDTH; x++) {
+                if (FONT[glyph - DIGIT_GLYPHS][y] & (0x4 >> x)) {
+                    // Shear the rows: slanted one column per row like the slanted digits, upright
+                    // in a zigzag like the upright 1
+                    uint8_t rise = FONT_HEIGHT - 1 - y;
+                    cols[x + (slanted ? rise : rise / 2)] |= 1 << (FONT_TOP_ROW + y);
+                }
+            }
+        }
+    }
+    uint8_t first = 0;
+    while ((first < PLedGeometry::COLS) && (cols[first] == 0)) {
+        first++;
+    }
+    for (uint8_t c = first; c < PLedGeometry::COLS; c++) {
+        if (cols[c] != 0) {
+            table.col[slanted][glyph][c - first] = cols[c];
+            table.width[slanted][glyph] = c - first + 1;
+        }
+    }
+}
+
+constexpr GlyphTable makeGlyphTable() {
+    GlyphTable table = {};
+    for (uint8_t slanted = 0; slanted < 2; slanted++) {
+        for (uint8_t glyph = 0; glyph < GLYPH_COUNT; glyph++) {
+            makeGlyph(table, slanted, glyph);
+        }
+    }
+    return table;
+}
+
+constexpr GlyphTable GLYPHS PLED_FLASH = makeGlyphTable();
+
+// Physical position of a LED is 2 * col + row in half LED's, the leftmost and rightmost one all
+// glyph rows reach
+constexpr int alignLeft() {
+    int left = 0;
+    for (uint8_t row = FONT_TOP_ROW; row < FONT_TOP_ROW + FONT_HEIGHT; row++) {
+        int pos = 2 * PLedGeometry::firstCol(row) + row;
+        left = (pos > left) ? pos : left;
+    }
+    return left;
+}
+
+constexpr int alignRight() {
+    int right = 2 * PLedGeometry::COLS + PLedGeometry::ROWS;
+    for (uint8_t row = FONT_TOP_ROW; row < FONT_TOP_ROW + FONT_HEIGHT; row++) {
+        int pos = 2 * PLedGeometry::lastCol(row) + row;
+        right = (pos < right) ? pos : right;
+    }
+    return right;
+}
+
+const int ALIGN_LEFT = alignLeft();
+const int ALIGN_RIGHT = alignRight();
+
+uint8_t glyphOf(char c) {
+    if ((c >= 'a') && (c <= 'z')) {
+        c -= 'a' - 'A';
+    }
+    for (uint8_t glyph = 0; glyph < GLYPH_COUNT; glyph++) {
+        if (PLED_READ_BYTE(&CHARS[glyph]) == c) {
+            return glyph;
+        }
+    }
+    return NO_GLYPH;
+}
+
+bool collides(const uint8_t *cols, uint8_t width, const uint8_t *blocked) {
+    for (uint8_t j = 0; j < width; j++) {
+        if (cols[j] & blocked[j]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int floorDiv(int a, int b) {
+    return (a >= 0) ? a / b : -((b - 1 - a) / b);
+}
+
+}  // namespace
+
+bool PLedLayout::set(const char *text, bool slanted, Align align) {
+    if ((strncmp(text, this->text, TEXT_MAX) == 0) && (slanted == this->slanted) && (align == this->align)) {
+        return false;
+    }
+    strncpy(this->text, text, TEXT_MAX);
+    this->text[TEXT_MAX] = '\0';
+    this->slanted = slanted;
+    this->align = align;
+
+    // Kerning: the LED's placed so far and their neighbours are blocked, every glyph goes to the
+    // first column where none of its LED's is blocked
+    uint8_t blocked[LAYOUT_COLS + 1] = {};
+    int left = 0;  // First column of the next glyph
+    int end = 0;   // Column after the glyphs placed
+    int lo = 2 * LAYOUT_COLS + PLedGeometry::ROWS;  // Physical extent of the run in half LED's
+    int hi = 0;
+    count = 0;
+    for (const char *c = this->text; *c != '\0'; c++) {
+        uint8_t g = glyphOf(*c);
+        if (g == NO_GLYPH) {
+            left = (end + SPACE_COLS > left) ? end + SPACE_COLS : left;
+            continue;
+        }
+        uint8_t width = PLED_READ_BYTE(&GLYPHS.width[slanted][g]);
+        uint8_t cols[GLYPH_COLS];
+        PLED_READ_BLOCK(cols, &GLYPHS.col[slanted][g], GLYPH_COLS);
+        int x = left;
+        while ((x + width <= LAYOUT_COLS) && collides(cols, width, &blocked[x])) {
+            x++;
+        }
+        if (x + width > LAYOUT_COLS) {
+            break;
+        }
+        for (uint8_t j = 0; j < width; j++) {
+            uint8_t bits = cols[j];
+            blocked[x + j] |= bits | (bits << 1) | (bits >> 1);
+            blocked[x + j + 1] |= bits | (bits >> 1);
+            if (x + j > 0) {
+                blocked[x + j - 1] |= bits | (bits << 1);
+            }
+            for (uint8_t row = 0; bits != 0; row++, bits >>= 1) {
+                if (bits & 1) {
+                    int pos = 2 * (x + j) + row;
+                    lo = (pos < lo) ? pos : lo;
+                    hi = (pos > hi) ? pos : hi;
+                }
+            }
+        }
+        glyph[count] = g;
+        col[count] = x;
+        count++;
+        left = x + 1;
+        end = (x + width > end) ? x + width : end;
+    }
+
+    if (count > 0) {
+        int shift;
+        switch (align) {
+            case Align::Left:
+                shift = -floorDiv(lo - ALIGN_LEFT, 2);
+                break;
+            case Align::Right:
+                shift = floorDiv(ALIGN_RIGHT - hi, 2);
+                break;
+            default:
+                shift = floorDiv(ALIGN_LEFT + ALIGN_RIGHT - lo - hi + 2, 4);
+                break;
+        }
+        for (uint8_t i = 0; i < count; i++) {
+            col[i] += shift;
+        }
+    }
+    version++;
+    return true;
+}
+
+void PLedLayout::draw(uint8_t i, LedMask &mask, int shift) const {
+    uint8_t width = PLED_READ_BYTE(&GLYPHS.width[slanted][glyph[i]]);
+    for (uint8_t j = 0; j < width; j++) {
+        int c = col[i] + j + shift;
+        if ((c < 0) || (c >= PLedGeometry::COLS)) {
+            continue;
+        }
+        uint8_t bits = PLED_READ_BYTE(&GLYPHS.col[slanted][glyph[i]][j]);
+        for (uint8_t row = 0; bits != 0; row++, bits >>= 1) {
+            uint8_t led = PLedGeometry::address(row, c);
+            if ((bits & 1) && (led != NO_LED)) {
+                mask.set(led);
+            }
+        }
+    }
+}
+
+void PLedLayout::drawAt(uint8_t i, int offset, LedMask &mask, uint8_t *cover) const {
+    uint8_t width = PLED_READ_BYTE(&GLYPHS.width[slanted][glyph[i]]);
+    for (uint8_t j = 0; j < width; j++) {
+        uint8_t bits = PLED_READ_BYTE(&GLYPHS.col[slanted][glyph[i]][j]);
+        PLedSubpixel::addColumn(bits, (col[i] + j) * PLedSubpixel::COLUMN + offset, mask, cover);
+    }
+}
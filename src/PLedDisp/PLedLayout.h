@@ -0,0 +1,89 @@
+/**
+ * @file PLedLayout.h
+ * @brief Layout of short labels on the lattice: digits, hex, a few letters, sign, degree and colon
+ *
+ * Every glyph is a bitmap of lattice columns, bit r of a column is row r. The digits are the ones
+ * of the digit tables in PLedGeometry, so a label looks like the clock; the other characters are
+ * a 3x5 pixel font sheared at compile time to the upright or slanted style. The glyphs are placed
+ * from left to right, each one as far left as it goes without a LED next to a LED of the glyphs
+ * before (kerning), then the run is aligned on the display. The layout is kept until the text or
+ * the style changes, drawing a glyph is one pass over its columns. A label can be drawn moved by
+ * whole columns or, split between the columns, by fractions of a column (PLedSubpixel).
+ *
+ * Characters: 0-9 A-F H L N O P R S T U Y - + : . / ' ' and '`' as degree sign (as PLedFont).
+ * Lower case letters are drawn as upper case, 'n' as a small n, others as blank.
+ *
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "LedMask.h"
+#include "PLedGeometry.h"
+#include "PLedSubpixel.h"
+
+class PLedLayout {
+   public:
+#ifdef BUILD_FOR_NANO
+    static const uint8_t TEXT_MAX = 7;  // Max. characters of a label, e.g. "-12.5`C"
+#else
+    static const uint8_t TEXT_MAX = 15;
+#endif
+    static const uint8_t GLYPH_COLS = 7;    // Max. lattice columns of a glyph
+    static const uint8_t SPACE_COLS = 2;    // Blank columns of ' ' added to the kerning
+    static const uint8_t LAYOUT_COLS = 32;  // Columns glyphs are placed in before aligning, longer runs are cut
+
+    enum class Align : uint8_t { Left, Center, Right };
+
+    /**
+     * @brief Lay out a label, nothing is done if it is the one laid out last
+     *
+     * @param text - Label, longer ones are cut, may be released after the call
+     * @param slanted - Slanted/italic or upright glyphs
+     * @param align - Where the run goes on the display
+     * @return true - The label was laid out anew
+     */
+    bool set(const char *text, bool slanted, Align align = Align::Center);
+
+    /**
+     * @brief Nbr of glyphs laid out, spaces and characters cut off don't count
+     */
+    inline uint8_t getCount() const {
+        return count;
+    }
+
+    /**
+     * @brief Changes with every new layout, e.g. as key of the rasterisation
+     */
+    inline uint16_t getVersion() const {
+        return version;
+    }
+
+    /**
+     * @brief Draw one glyph, LED's off the display are dropped
+     *
+     * @param i - 0--getCount()-1 from the left
+     * @param mask - Mask to add the lit LED's to
+     * @param shift - Columns to move the glyph to the right, negative to the left
+     */
+    void draw(uint8_t i, LedMask &mask, int shift = 0) const;
+
+    /**
+     * @brief Draw one glyph moved by a fraction of a column, split between the columns
+     *
+     * @param i - 0--getCount()-1 from the left
+     * @param offset - 1/PLedSubpixel::COLUMN columns to move the glyph to the right, negative to the left
+     * @param mask - Mask to add the LED's to, also the ones only partly lit
+     * @param cover - Coverage per LED address, LedMask::BITS + 1 entries, see PLedSubpixel
+     */
+    void drawAt(uint8_t i, int offset, LedMask &mask, uint8_t *cover) const;
+
+   private:
+    char text[TEXT_MAX + 1] = "";
+    bool slanted = false;
+    Align align = Align::Center;
+    uint8_t count = 0;
+    uint8_t glyph[TEXT_MAX];  // Glyph of the font tables
+    int8_t col[TEXT_MAX];     // Lattice column of the glyph's column 0
+    uint16_t version = 0;
+};
@@ -0,0 +1,99 @@
+/**
+ * @file PLedOutput.cpp
+ * @date 2026-10-15
+ *
+ */
+
+#include "PLedOutput.h"
+
+PLedOutput::PLedOutput() {
+}
+
+PLedOutput::~PLedOutput() {
+    waitIdle();
+#ifdef BUILD_FOR_ESP32
+    if (TaskOutput != nullptr) {
+        vTaskDelete(TaskOutput);
+    }
+    if (outputIdle != nullptr) {
+        vSemaphoreDelete(outputIdle);
+    }
+#endif
+}
+
+void PLedOutput::begin(CRGB *front, CRGB *back, uint16_t nLeds) {
+    this->frontBuffer = front;
+    this->backBuffer = back;
+    this->nLeds = nLeds;
+    memset(front, 0, nLeds * sizeof(CRGB));
+    memset(back, 0, nLeds * sizeof(CRGB));
+
+#ifdef BUILD_FOR_ESP32
+    if (front != back) {
+        outputIdle = xSemaphoreCreateBinary();
+        xSemaphoreGive(outputIdle);
+        xTaskCreatePinnedToCore(
+            TaskOutputCode, /* Function to implement the task */
+            "TaskOutput",   /* Name of the task */
+            4096,           /* Stack size */
+            this,           /* Task input parameter */
+            3,              /* Priority of the task, above the render task */
+            &TaskOutput,    /* Task handle. */
+            1);             /* Core where the task should run, keeps core 0 free for NTP */
+    }
+#endif
+}
+
+void PLedOutput::present() {
+#ifdef BUILD_FOR_ESP32
+    if (TaskOutput != nullptr) {
+        // Previous frame has to leave the front buffer before it is reused
+        xSemaphoreTake(outputIdle, portMAX_DELAY);
+        CRGB *rendered = backBuffer;
+        backBuffer = frontBuffer;
+        frontBuffer = rendered;
+        FastLED[0].setLeds(frontBuffer, nLeds);
+        xTaskNotifyGive(TaskOutput);
+        return;
+    }
+#endif
+
+    if (frontBuffer != backBuffer) {
+        CRGB *rendered = backBuffer;
+        backBuffer = frontBuffer;
+        frontBuffer = rendered;
+        FastLED[0].setLeds(frontBuffer, nLeds);
+    }
+    show();
+}
+
+void PLedOutput::waitIdle() {
+#ifdef BUILD_FOR_ESP32
+    if (TaskOutput != nullptr) {
+        xSemaphoreTake(outputIdle, portMAX_DELAY);
+        xSemaphoreGive(outputIdle);
+    }
+#endif
+}
+
+void PLedOutput::show() {
+#ifdef PLED_PROFILING
+    if (profiler != nullptr) {
+        PLED_PROFILE(*profiler, Show, FastLED.show());
+        return;
+    }
+#endif
+    FastLED.show();
+}
+
+#ifdef BUILD_FOR_ESP32
+void PLedOutput::TaskOutputCode(void *pvParameters) {
+    PLedOutput *output = static_cast<PLedOutput *>(pvParameters);
+
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        output->show();
+        xSemaphoreGive(output->outputIdle);
+    }
+}
+#endif
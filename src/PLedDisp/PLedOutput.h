@@ -0,0 +1,94 @@
+/**
+ * @file PLedOutput.h
+ * @brief Double-buffered output of the composed frames to the LED strip
+ *
+ * Frames are rendered into the back buffer while the front buffer is transmitted. present()
+ * swaps the buffers at the frame boundary and starts the transmission. On the ESP32 a
+ * dedicated task runs FastLED.show(), so the RMT transmission of frame N overlaps the
+ * rendering of frame N+1 and the render task does not block for the transmit time.
+ * On other targets present() transmits synchronously.
+ *
+ * @date 2026-10-15
+ */
+
+#pragma once
+
+#include <FastLED.h>
+
+#include "PLedProfiler.h"
+
+class PLedOutput {
+   public:
+    /**
+     * @brief Construct a new PLedOutput object
+     *
+     */
+    PLedOutput();
+
+    /**
+     * @brief Destroy the PLedOutput object, waits for a running transmission
+     *
+     */
+    ~PLedOutput();
+
+    /**
+     * @brief Take over the frame buffers, front must be the one registered with FastLED.addLeds
+     *
+     * @param front - Buffer transmitted first
+     * @param back - Buffer rendered first, same as front for single buffering
+     * @param nLeds - Nbr of LED's per buffer
+     */
+    void begin(CRGB *front, CRGB *back, uint16_t nLeds);
+
+    /**
+     * @brief Buffer to render the next frame into
+     */
+    inline CRGB *back() const {
+        return backBuffer;
+    }
+
+    /**
+     * @brief Swap the buffers and transmit the frame rendered into the back buffer.
+     * Waits only if the previous transmission is still running.
+     */
+    void present();
+
+    /**
+     * @brief Wait until the last frame is transmitted
+     */
+    void waitIdle();
+
+#ifdef PLED_PROFILING
+    /**
+     * @brief Time the transmissions as PLedProfiler::Show
+     *
+     * @param profiler - Profiler to record into, nullptr to stop timing
+     */
+    inline void setProfiler(PLedProfiler *profiler) {
+        this->profiler = profiler;
+    }
+#endif
+
+   private:
+    /**
+     * @brief Transmit the front buffer
+     */
+    void show();
+
+    CRGB *frontBuffer = nullptr;
+    CRGB *backBuffer = nullptr;
+    uint16_t nLeds = 0;
+#ifdef PLED_PROFILING
+    PLedProfiler *profiler = nullptr;
+#endif
+
+#ifdef BUILD_FOR_ESP32
+    /**
+     * @brief Task transmitting the front buffer each time it is notified
+     */
+    static void TaskOutputCode(void *pvParameters);
+
+    TaskHandle_t TaskOutput = nullptr;
+    SemaphoreHandle_t outputIdle = nullptr;  ///< Given when no transmission is running
+#endif
+};
@@ -0,0 +1,89 @@
+/**
+ * @file PLedParticles.h
+ * @brief Fixed-capacity particle pool shared by the particle effects of the background
+ *
+ * Particles are stored as structure of arrays with 8 bit fields. The free list is a bitmask:
+ * spawn() takes the lowest free slot and despawn() returns it, both with a single bit
+ * operation, and step() only visits living particles. Slots are reused in ascending order,
+ * so an effect behaves the same for any capacity as long as the pool does not run full.
+ *
+ * @date 2026-10-15
+ */
+
+#pragma once
+
+#include <FastLED.h>
+#include <stdint.h>
+
+#include "PLedRandom.h"
+
+template <uint8_t CAPACITY>
+class PLedParticles {
+    static_assert((CAPACITY > 0) && (CAPACITY <= 32), "The free list holds at most 32 slots");
+
+   public:
+    static const uint8_t NONE = 0xFF;  // No slot free
+
+    uint8_t pos[CAPACITY] = {};    // Position, LED address or column depending on the effect
+    uint8_t stage[CAPACITY] = {};  // Animation stage or remaining life
+    uint8_t hue[CAPACITY] = {};    // Colour
+    uint8_t flags[CAPACITY] = {};  // Effect specific
+
+    /**
+     * @brief Take the lowest free slot
+     *
+     * @return uint8_t - Slot of the new particle or NONE if the pool is full
+     */
+    inline uint8_t spawn() {
+        if (freeSlots == 0) {
+            return NONE;
+        }
+        uint8_t i = __builtin_ctzl(freeSlots);
+        freeSlots &= ~(1UL << i);
+        return i;
+    }
+
+    /**
+     * @brief Return the slot of a particle, its fields keep their values until the slot is reused
+     *
+     * @param i - Slot of the particle
+     */
+    inline void despawn(uint8_t i) {
+        freeSlots |= (1UL << i);
+    }
+
+    inline bool full() const {
+        return freeSlots == 0;
+    }
+
+    inline uint8_t count() const {
+        return CAPACITY - __builtin_popcountl(freeSlots);
+    }
+
+    /**
+     * @brief Advance the effect by one step: maybe spawn a particle, then update all living ones
+     *
+     * @param rng - Random numbers of the effect
+     * @param chance - Probability to spawn a particle, x/256 (one random8() per step)
+     * @param init - init(slot) sets up a new particle
+     * @param update - update(slot) draws and advances a particle, returns false when it dies
+     */
+    template <typename Init, typename Update>
+    inline void step(PLedRandom &rng, uint8_t chance, Init init, Update update) {
+        if ((rng.random8() < chance) && !full()) {
+            init(spawn());
+        }
+        uint32_t living = ~freeSlots & ALL_SLOTS;
+        while (living) {
+            uint8_t i = __builtin_ctzl(living);
+            living &= living - 1;
+            if (!update(i)) {
+                despawn(i);
+            }
+        }
+    }
+
+   private:
+    static const uint32_t ALL_SLOTS = (CAPACITY == 32) ? 0xFFFFFFFFUL : ((1UL << (CAPACITY & 31)) - 1);
+    uint32_t freeSlots = ALL_SLOTS;
+};
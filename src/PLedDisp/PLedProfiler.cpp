@@ -0,0 +1,105 @@
+/**
+ * @file PLedProfiler.cpp
+ * @date 2026-10-15
+ *
+ */
+
+#include "PLedProfiler.h"
+
+#ifdef PLED_PROFILING
+
+static const char *const STAGE_NAMES[PLedProfiler::StageCount] = {"bg", "frame", "fg", "plan", "compose", "show", "total"};
+
+/**
+ * @brief Write a value little endian
+ */
+template <typename T>
+static void writeLE(Print &out, T value) {
+    for (uint8_t i = 0; i < sizeof(T); i++) {
+        out.write(uint8_t(value >> (8 * i)));
+    }
+}
+
+void PLedProfiler::record(Stage stage, uint32_t elapsed) {
+    StageStats &s = stats[stage];
+
+    uint32_t us = elapsed / CYCLES_PER_US;
+    uint8_t bucket = 0;
+    while ((us != 0) && (bucket < BUCKETS - 1)) {
+        us >>= 1;
+        bucket++;
+    }
+    if (s.histogram[bucket] < 0xFFFF) {
+        s.histogram[bucket]++;
+    }
+    s.samples++;
+
+    if (elapsed < s.windowMin) {
+        s.windowMin = elapsed;
+    }
+    if (elapsed > s.windowMax) {
+        s.windowMax = elapsed;
+    }
+    s.windowSum += elapsed;
+    if (++s.windowCount == WINDOW) {
+        s.min = s.windowMin;
+        s.avg = s.windowSum / WINDOW;
+        s.max = s.windowMax;
+        s.windowMin = 0xFFFFFFFFUL;
+        s.windowMax = 0;
+        s.windowSum = 0;
+        s.windowCount = 0;
+    }
+}
+
+void PLedProfiler::reset() {
+    for (uint8_t i = 0; i < StageCount; i++) {
+        stats[i] = StageStats();
+    }
+}
+
+void PLedProfiler::report(Print &out) const {
+    out.print("stage min/avg/max [us] over ");
+    out.print((unsigned long)WINDOW);
+    out.println(" samples, histogram [2^b us]");
+    for (uint8_t i = 0; i < StageCount; i++) {
+        const StageStats &s = stats[i];
+        out.print(STAGE_NAMES[i]);
+        out.print(": ");
+        out.print((unsigned long)(s.min / CYCLES_PER_US));
+        out.print("/");
+        out.print((unsigned long)(s.avg / CYCLES_PER_US));
+        out.print("/");
+        out.print((unsigned long)(s.max / CYCLES_PER_US));
+        out.print(" n=");
+        out.print((unsigned long)s.samples);
+        out.print(" |");
+        for (uint8_t b = 0; b < BUCKETS; b++) {
+            out.print(" ");
+            out.print((unsigned long)s.histogram[b]);
+        }
+        out.println();
+    }
+}
+
+void PLedProfiler::dump(Print &out) const {
+    out.write('P');
+    out.write('L');
+    out.write('P');
+    out.write(FORMAT_VERSION);
+    out.write(uint8_t(StageCount));
+    out.write(BUCKETS);
+    writeLE<uint32_t>(out, CYCLES_PER_US);
+    for (uint8_t i = 0; i < StageCount; i++) {
+        const StageStats &s = stats[i];
+        writeLE<uint32_t>(out, s.min);
+        writeLE<uint32_t>(out, s.avg);
+        writeLE<uint32_t>(out, s.max);
+        writeLE<uint32_t>(out, s.samples);
+        for (uint8_t b = 0; b < BUCKETS; b++) {
+            writeLE<uint16_t>(out, s.histogram[b]);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,124 @@
+/**
+ * @file PLedProfiler.h
+ * @brief Per-stage timing of the render pipeline
+ *
+ * Each stage of PLedDisp::update_LEDs() is timed with the cycle counter of the target.
+ * Per stage the min/avg/max of the last window of WINDOW samples and a histogram of all
+ * samples since the last reset are kept. report() prints them as text, dump() writes
+ * them in a compact binary format.
+ *
+ * Only compiled when PLED_PROFILING is defined, e.g. build_flags = -D PLED_PROFILING.
+ * Otherwise PLED_PROFILE(profiler, stage, code...) runs the code without any timing.
+ *
+ * Binary dump, little endian:
+ *  "PLP" 2 (format version), uint8 stages, uint8 buckets, uint32 cycles per us,
+ *  per stage: uint32 min, avg, max [cycles], uint32 samples, uint16 histogram[buckets]
+ *
+ * @date 2026-10-15
+ */
+
+#pragma once
+
+#ifdef PLED_PROFILING
+
+#include <Arduino.h>
+#ifdef BUILD_FOR_NATIVE
+#include <chrono>
+#endif
+
+class PLedProfiler {
+   public:
+    /**
+     * @brief Timed stages of a frame
+     */
+    enum Stage : uint8_t { Background,  // Background layer
+                           Frame,       // Frame layer
+                           Foreground,  // Foreground layer
+                           Plan,        // Compiling the render plan with the static layers and the warnings
+                           Compose,     // Merging the layers and frame hash
+                           Show,        // FastLED.show()
+                           Total,       // Whole update_LEDs()
+                           StageCount };
+
+    static const uint16_t WINDOW = 64;        // Samples per min/avg/max window
+    static const uint8_t BUCKETS = 16;        // Bucket b counts samples of 2^(b-1) to 2^b - 1 us, the last one all longer
+    static const uint8_t FORMAT_VERSION = 2;  // Version of the binary dump, 2: stage 3 is Plan instead of Overlay
+
+#ifdef BUILD_FOR_ESP32
+    static const uint32_t CYCLES_PER_US = F_CPU / 1000000;
+#elif BUILD_FOR_NATIVE
+    static const uint32_t CYCLES_PER_US = 1000;  // Nanoseconds of the host clock
+#else
+    static const uint32_t CYCLES_PER_US = 1;  // micros(), no cycle counter
+#endif
+
+    /**
+     * @brief Read the cycle counter
+     */
+    static inline uint32_t cycles() {
+#ifdef BUILD_FOR_ESP32
+        return ESP.getCycleCount();
+#elif BUILD_FOR_NATIVE
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#else
+        return micros();
+#endif
+    }
+
+    /**
+     * @brief Add a sample to a stage
+     *
+     * @param stage - Timed stage
+     * @param elapsed - Duration [cycles]
+     */
+    void record(Stage stage, uint32_t elapsed);
+
+    /**
+     * @brief Clear all samples
+     */
+    void reset();
+
+    /**
+     * @brief Print min/avg/max [us] and the histogram of every stage
+     *
+     * @param out - Output e.g. Serial
+     */
+    void report(Print &out) const;
+
+    /**
+     * @brief Write all stages in the binary format described above
+     *
+     * @param out - Output e.g. Serial
+     */
+    void dump(Print &out) const;
+
+   private:
+    struct StageStats {
+        uint32_t min = 0;  // Of the last completed window [cycles]
+        uint32_t avg = 0;
+        uint32_t max = 0;
+        uint32_t samples = 0;  // Since the last reset
+        uint16_t histogram[BUCKETS] = {};
+
+        uint32_t windowMin = 0xFFFFFFFFUL;  // Of the running window
+        uint32_t windowMax = 0;
+        uint32_t windowSum = 0;
+        uint16_t windowCount = 0;
+    } stats[StageCount];
+};
+
+#define PLED_PROFILE(profiler, stage, ...)                                             \
+    do {                                                                               \
+        uint32_t profileStart = PLedProfiler::cycles();                                \
+        __VA_ARGS__;                                                                   \
+        (profiler).record(PLedProfiler::stage, PLedProfiler::cycles() - profileStart); \
+    } while (0)
+
+#else
+
+#define PLED_PROFILE(profiler, stage, ...) \
+    do {                                   \
+        __VA_ARGS__;                       \
+    } while (0)
+
+#endif
@@ -0,0 +1,73 @@
+/**
+ * @file PLedRandom.h
+ * @brief Seedable random number generator of the effects
+ *
+ * Xorshift32 (Marsaglia, shifts 13/17/5): three shifts and xors per number, no multiplication,
+ * period 2^32 - 1. The effects draw from the generator owned by PLedDisp instead of the global
+ * FastLED/Arduino generators, so the same seed renders the same frames on every target and in
+ * the host tests. The helpers have the ranges of FastLED's random8/random16.
+ *
+ * @date 2026-10-15
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+class PLedRandom {
+   public:
+    static const uint32_t DEFAULT_SEED = 0x2545F491UL;
+
+    explicit PLedRandom(uint32_t seed = DEFAULT_SEED) {
+        setSeed(seed);
+    }
+
+    /**
+     * @brief Restart the sequence
+     *
+     * @param seed - Any value, 0 is replaced by DEFAULT_SEED (xorshift would stay at 0)
+     */
+    inline void setSeed(uint32_t seed) {
+        state = (seed != 0) ? seed : DEFAULT_SEED;
+    }
+
+    inline uint32_t next() {
+        uint32_t x = state;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        state = x;
+        return x;
+    }
+
+    /**
+     * @brief Random number 0--255
+     */
+    inline uint8_t random8() {
+        return next() >> 24;
+    }
+
+    /**
+     * @brief Random number 0--lim-1
+     */
+    inline uint8_t random8(uint8_t lim) {
+        return ((uint16_t)random8() * lim) >> 8;
+    }
+
+    /**
+     * @brief Random number min--lim-1
+     */
+    inline uint8_t random8(uint8_t min, uint8_t lim) {
+        return random8(lim - min) + min;
+    }
+
+    /**
+     * @brief Random number 0--65535
+     */
+    inline uint16_t random16() {
+        return next() >> 16;
+    }
+
+   private:
+    uint32_t state;
+};
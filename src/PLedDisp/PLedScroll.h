@@ -0,0 +1,94 @@
+/**
+ * @file PLedScroll.h
+ * @brief Scrolling window over a ring buffer
+ *
+ * A scrolling effect shows a window of a ring buffer, e.g. the colour ramp of the rainbow or
+ * the columns of a text. Scrolling only moves the start offset of the window, the content of
+ * the ring stays in place. advance() reports whether the offset moved, so the layer is only
+ * rasterised again when the visible content changed.
+ *
+ * @date 2026-10-15
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+class PLedScroll {
+   public:
+    /**
+     * @brief Construct a new PLedScroll object
+     *
+     * @param length - Nbr of entries of the ring buffer
+     * @param stepsPerShift - Animation steps until the window moves by one entry
+     * @param start - Entry of the ring at the first position of the window
+     */
+    PLedScroll(uint16_t length, uint8_t stepsPerShift, uint16_t start = 0)
+        : length(length), stepsPerShift(stepsPerShift), start(start % length) {
+    }
+
+    /**
+     * @brief Advance by animation steps
+     *
+     * @param steps - Nbr of animation steps
+     * @return true - The start offset moved, the window shows a new content
+     * @return false - Still the same content
+     */
+    inline bool advance(uint8_t steps) {
+        uint16_t total = counter + steps;
+        uint16_t shifts = total / stepsPerShift;
+        counter = total % stepsPerShift;
+        if (shifts == 0) {
+            return false;
+        }
+        start = (start + shifts) % length;
+        return true;
+    }
+
+    /**
+     * @brief Move the window to an entry of the ring
+     *
+     * @param entry - Entry of the ring at the first position of the window
+     */
+    inline void setStart(uint16_t entry) {
+        start = entry % length;
+        counter = 0;
+    }
+
+    inline uint16_t getStart() const {
+        return start;
+    }
+
+    /**
+     * @brief Entry of the ring at a position of the window
+     *
+     * @param pos - Position in the window 0--length-1
+     */
+    inline uint16_t index(uint16_t pos) const {
+        uint16_t entry = start + pos;
+        return (entry >= length) ? entry - length : entry;
+    }
+
+    /**
+     * @brief Visit the first positions of the window
+     *
+     * @param count - Nbr of positions, at most length
+     * @param fn - fn(pos, entry) with the ring entry shown at pos
+     */
+    template <typename Fn>
+    inline void forEach(uint16_t count, Fn fn) const {
+        uint16_t entry = start;
+        for (uint16_t pos = 0; pos < count; pos++) {
+            fn(pos, entry);
+            if (++entry == length) {
+                entry = 0;
+            }
+        }
+    }
+
+   private:
+    const uint16_t length;
+    const uint8_t stepsPerShift;
+    uint16_t start;
+    uint8_t counter = 0;  // Steps since the last shift
+};
@@ -0,0 +1,63 @@
+/**
+ * @file PLedShade.cpp
+ * @date 2026-10-16
+ *
+ */
+
+#include "PLedShade.h"
+
+namespace {
+void solid(PLedLayer &layer, const LedMask &mask, const PLedShade::Context &ctx) {
+#ifdef PLED_INDEXED_COLOR
+    const PLedPixel pixel = 0;  // The palette is the colour
+#else
+    const PLedPixel &pixel = ctx.color;
+#endif
+    mask.forEach([&](uint8_t led) {
+        layer.px[led] = pixel;
+    });
+    layer.mask |= mask;
+}
+
+void rainbow(PLedLayer &layer, const LedMask &mask, const PLedShade::Context &ctx) {
+    mask.forEach([&](uint8_t led) {
+#ifdef PLED_INDEXED_COLOR
+        layer.px[led] = ctx.scroll->index(led);  // The palette is the rainbow
+#else
+        layer.px[led] = ctx.rainbow->at(ctx.scroll->index(led));
+#endif
+    });
+    layer.mask |= mask;
+}
+
+void gradient(PLedLayer &layer, const LedMask &mask, const PLedShade::Context &ctx) {
+    PLedPixel rows[PLedGeometry::ROWS];
+    for (uint8_t row = 0; row < PLedGeometry::ROWS; row++) {
+#ifdef PLED_INDEXED_COLOR
+        rows[row] = row * PLedShade::ENTRY_STEP;
+#else
+        rows[row] = PLedShade::gradientRow(ctx.color, ctx.second, row);
+#endif
+    }
+    mask.forEach([&](uint8_t led) {
+        layer.px[led] = rows[PLedGeometry::row(led)];
+    });
+    layer.mask |= mask;
+}
+
+void digits(PLedLayer &layer, const LedMask &mask, const PLedShade::Context &ctx) {
+#ifdef PLED_INDEXED_COLOR
+    const PLedPixel pixel = ctx.glyph * PLedShade::ENTRY_STEP;
+#else
+    const PLedPixel &pixel = (ctx.glyph < PLedShade::DIGIT_COUNT) ? ctx.digitColors[ctx.glyph] : ctx.color;
+#endif
+    mask.forEach([&](uint8_t led) {
+        layer.px[led] = pixel;
+    });
+    layer.mask |= mask;
+}
+}  // namespace
+
+namespace PLedShade {
+const Kernel KERNELS[KernelCount] = {solid, rainbow, gradient, digits};
+}  // namespace PLedShade
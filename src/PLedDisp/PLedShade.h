@@ -0,0 +1,75 @@
+/**
+ * @file PLedShade.h
+ * @brief Shading kernels of the foreground: colour the LED's of a glyph mask
+ *
+ * The kernel is picked once when the foreground mode or colours are set, rasterising a glyph is
+ * one call that fills the whole mask in a single loop without testing the mode per LED.
+ * All kernels have the same signature, a new shader is one more function and entry in KERNELS.
+ * With PLED_INDEXED_COLOR the kernels write palette indices, the palette of the foreground layer
+ * holds the colours (see PLedDisp::update_palettes()).
+ *
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include <FastLED.h>
+
+#include "LedMask.h"
+#include "PLedColorRamp.h"
+#include "PLedCompositor.h"
+#include "PLedGeometry.h"
+#include "PLedScroll.h"
+
+namespace PLedShade {
+
+const uint8_t DIGIT_COUNT = 4;  // Glyphs with their own colour in Digits
+const uint8_t GLYPH_COLON = 4;  // Glyph of the colon, shaded with the first colour
+
+/**
+ * @brief Inputs of the kernels, filled by the display
+ */
+struct Context {
+    CRGB color;                    // First colour
+    CRGB second;                   // Bottom colour of Gradient
+    const CRGB *digitColors;       // DIGIT_COUNT colours of Digits
+    const PLedColorRamp *rainbow;  // Colours of the hues of Rainbow
+    const PLedScroll *scroll;      // Hue of every LED of Rainbow
+    uint8_t glyph;                 // Glyph of the mask 0--DIGIT_COUNT-1 or GLYPH_COLON
+};
+
+/**
+ * @brief Draw the LED's of a mask on a layer
+ *
+ * @param layer - Layer to draw on, the LED's of mask are covered afterwards
+ * @param mask - LED's to draw, one glyph
+ * @param ctx - Colours
+ */
+typedef void (*Kernel)(PLedLayer &layer, const LedMask &mask, const Context &ctx);
+
+/**
+ * @brief Kernels, index of KERNELS
+ */
+enum Id : uint8_t { Solid,     // One colour
+                    Rainbow,   // Hue of rainbowScroll per LED, as the rainbow background
+                    Gradient,  // Top row colour to bottom row second
+                    Digits,    // One colour per glyph
+                    KernelCount };
+
+extern const Kernel KERNELS[KernelCount];
+
+/**
+ * @brief Colour of a row in Gradient
+ *
+ * @param row - 0--PLedGeometry::ROWS-1
+ */
+inline CRGB gradientRow(const CRGB &color, const CRGB &second, uint8_t row) {
+    return blend(color, second, (row * 255) / (PLedGeometry::ROWS - 1));
+}
+
+#ifdef PLED_INDEXED_COLOR
+// Palette index of entry 1, Gradient uses one entry per row, Digits one per glyph and the colon
+const uint8_t ENTRY_STEP = 16;
+#endif
+
+}  // namespace PLedShade
@@ -0,0 +1,81 @@
+/**
+ * @file PLedSubpixel.h
+ * @brief Glyph columns at fractional lattice positions, split between neighbouring balls
+ *
+ * Glyphs are drawn column by column (bit r of a column is row r, as PLedText and PLedLayout hold
+ * them). A column between two lattice columns lights the balls of both, sharing its intensity by
+ * a pair of coverage weights that sum to 255: a run of lit LED's in a row stays fully lit and only
+ * its ends fade, so a moving glyph glides instead of jumping a whole ball. The weights of the
+ * PHASES positions between two columns are generated into flash at compile time. The coverage of
+ * all glyphs is added up per LED and handed to the layer (PLedLayer::setCoverage(), PLED_COVERAGE).
+ *
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "LedMask.h"
+#include "PLedGeometry.h"
+
+namespace PLedSubpixel {
+
+const uint8_t PHASES = 16;      // Positions between two columns
+const uint16_t COLUMN = 256;    // Positions are in 1/COLUMN columns
+const uint8_t FULL = 255;       // Coverage of a LED fully lit
+const uint8_t PHASE_SHIFT = 4;  // Position in a column to phase
+static_assert((COLUMN >> PHASE_SHIFT) == PHASES, "PHASE_SHIFT must match PHASES");
+
+struct WeightTable {
+    uint8_t right[PHASES];  // Coverage of the ball on the right, the left one gets FULL - right
+};
+
+constexpr WeightTable makeWeightTable() {
+    WeightTable table = {};
+    for (uint8_t phase = 0; phase < PHASES; phase++) {
+        table.right[phase] = (phase * FULL + PHASES / 2) / PHASES;
+    }
+    return table;
+}
+
+inline constexpr WeightTable WEIGHTS PLED_FLASH = makeWeightTable();
+
+/**
+ * @brief Add the LED's of a column at a whole lattice column
+ *
+ * @param bits - Rows lit, bit r is row r
+ * @param col - Any column, columns off the lattice are dropped
+ * @param weight - Coverage added to the LED's
+ * @param mask - Mask to add the LED's to
+ * @param cover - Coverage per LED address, LedMask::BITS + 1 entries
+ */
+inline void addBalls(uint8_t bits, int col, uint8_t weight, LedMask &mask, uint8_t *cover) {
+    if ((col < 0) || (col >= PLedGeometry::COLS)) {
+        return;
+    }
+    for (uint8_t row = 0; bits != 0; row++, bits >>= 1) {
+        uint8_t led = PLedGeometry::address(row, col);
+        if ((bits & 1) && (led != PLedGeometry::NO_LED)) {
+            mask.set(led);
+            cover[led] = (cover[led] > FULL - weight) ? FULL : cover[led] + weight;
+        }
+    }
+}
+
+/**
+ * @brief Add the LED's of a column at a fractional position
+ *
+ * @param bits - Rows lit, bit r is row r
+ * @param pos - Position in 1/COLUMN lattice columns, may be off the lattice
+ * @param mask - Mask to add the LED's to, also the ones only partly lit
+ * @param cover - Coverage per LED address, LedMask::BITS + 1 entries, added up saturating
+ */
+inline void addColumn(uint8_t bits, int pos, LedMask &mask, uint8_t *cover) {
+    int col = (pos >= 0) ? pos / COLUMN : -((COLUMN - 1 - pos) / COLUMN);
+    uint8_t right = PLED_READ_BYTE(&WEIGHTS.right[(pos - col * COLUMN) >> PHASE_SHIFT]);
+    addBalls(bits, col, FULL - right, mask, cover);
+    if (right != 0) {
+        addBalls(bits, col + 1, right, mask, cover);
+    }
+}
+
+}  // namespace PLedSubpixel
@@ -0,0 +1,86 @@
+/**
+ * @file PLedText.cpp
+ * @date 2026-10-15
+ *
+ */
+
+#include "PLedText.h"
+
+#include <string.h>
+
+void PLedText::setText(const char *text) {
+#ifdef BUILD_FOR_ESP32
+    portENTER_CRITICAL(&pendingLock);
+#endif
+    strncpy(pending, text, TEXT_MAX);
+    pending[TEXT_MAX] = '\0';
+    hasPending = true;
+#ifdef BUILD_FOR_ESP32
+    portEXIT_CRITICAL(&pendingLock);
+#endif
+}
+
+void PLedText::advance(uint8_t steps) {
+    fraction += (uint32_t)speed * steps;
+    while (fraction >= 256) {
+        fraction -= 256;
+        window[head] = nextColumn();
+        head = (head + 1) % PLedGeometry::COLS;
+        scrolled++;
+    }
+}
+
+void PLedText::draw(LedMask &mask) const {
+    for (uint8_t x = 0; x < PLedGeometry::COLS; x++) {
+        uint8_t bits = window[(head + x) % PLedGeometry::COLS];
+        for (uint8_t row = 0; bits != 0; row++, bits >>= 1) {
+            uint8_t led = PLedGeometry::address(row, x);
+            if ((bits & 1) && (led != PLedGeometry::NO_LED)) {
+                mask.set(led);
+            }
+        }
+    }
+}
+
+void PLedText::draw(LedMask &mask, uint8_t *cover) const {
+    for (uint8_t x = 0; x < PLedGeometry::COLS; x++) {
+        uint8_t bits = window[(head + x) % PLedGeometry::COLS];
+        if (bits != 0) {
+            PLedSubpixel::addColumn(bits, (x + 1) * PLedSubpixel::COLUMN - fraction, mask, cover);
+        }
+    }
+}
+
+//=====PRIVATE====================================================================================
+uint8_t PLedText::nextColumn() {
+    if (charIndex == length) {
+        // Gap after the text, a new text starts after it or right away on an empty display
+        if ((charCol < GAP) && (length != 0)) {
+            charCol++;
+            return 0;
+        }
+        if (hasPending) {
+            // Text and flag are taken over together, a setText() on another task waits meanwhile
+#ifdef BUILD_FOR_ESP32
+            portENTER_CRITICAL(&pendingLock);
+#endif
+            memcpy(text, pending, sizeof(text));
+            hasPending = false;
+#ifdef BUILD_FOR_ESP32
+            portEXIT_CRITICAL(&pendingLock);
+#endif
+            length = strlen(text);
+        }
+        charIndex = 0;
+        charCol = 0;
+        if (length == 0) {
+            return 0;
+        }
+    }
+    uint8_t bits = (charCol < PLedFont::WIDTH) ? PLedFont::column(text[charIndex], charCol) : 0;
+    if (++charCol == PLedFont::WIDTH + SPACING) {
+        charIndex++;
+        charCol = 0;
+    }
+    return bits;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file PLedText.h
+ * @brief Scrolling text streamed column by column from the flash font
+ *
+ * The text scrolls from right to left along the slanted columns of the lattice. Only the visible
+ * window of PLedGeometry::COLS font columns is kept, as a ring buffer of one byte per column:
+ * when the text moved by a whole column the oldest column drops out and the next one is read
+ * from PLedFont. The position advances in 1/256 columns per animation step, so any speed scrolls
+ * evenly. Drawn with coverage the text glides between the columns (PLedSubpixel), otherwise it
+ * moves by whole columns. The text is copied into a fixed buffer, nothing is allocated.
+ *
+ * @date 2026-10-15
+ */
+
+#pragma once
+
+#ifdef BUILD_FOR_ESP32
+#include <Arduino.h>  // portMUX_TYPE
+#endif
+
+#include "LedMask.h"
+#include "PLedFont.h"
+#include "PLedGeometry.h"
+#include "PLedSubpixel.h"
+
+class PLedText {
+   public:
+    static const uint8_t TEXT_MAX = 47;  // Max. characters of a text, the text is held twice
+    static const uint8_t SPACING = 1;               // Blank columns after every glyph
+    static const uint8_t GAP = PLedGeometry::COLS;  // Blank columns before the text starts over
+    static const uint16_t DEFAULT_SPEED = 128;      // 1/256 columns per step, 10 columns/s at 20 Hz
+
+    /**
+     * @brief Set the text, it starts at the right edge once the current one has scrolled out
+     *
+     * May be called from another task than the one drawing: the text is copied aside and taken
+     * over when the next column after the gap is read. On the ESP32 both copies run in a critical
+     * section, so a text is never taken over half written.
+     *
+     * @param text - Text, longer ones are cut, may be released after the call
+     */
+    void setText(const char *text);
+
+    /**
+     * @brief Set the scroll speed
+     *
+     * @param speed - 1/256 columns per animation step
+     */
+    inline void setSpeed(uint16_t speed) {
+        this->speed = speed;
+    }
+
+    /**
+     * @brief Advance the scrolling
+     *
+     * @param steps - Animation steps since the last call
+     */
+    void advance(uint8_t steps);
+
+    /**
+     * @brief Whole columns scrolled so far, e.g. as key of the rasterisation
+     */
+    inline uint16_t getScrolled() const {
+        return scrolled;
+    }
+
+    /**
+     * @brief Part of a column scrolled beyond getScrolled() in 1/256 columns
+     */
+    inline uint8_t getFraction() const {
+        return fraction;
+    }
+
+    /**
+     * @brief Draw the visible window, the display colours it with its foreground shading
+     *
+     * @param mask - Mask to add the lit LED's to
+     */
+    void draw(LedMask &mask) const;
+
+    /**
+     * @brief Draw the visible window at the exact scroll position, split between the columns
+     *
+     * The window is one column further right than with draw(), so the columns glide in at the
+     * right edge and out at the left one.
+     *
+     * @param mask - Mask to add the LED's to, also the ones only partly lit
+     * @param cover - Coverage per LED address, LedMask::BITS + 1 entries, see PLedSubpixel
+     */
+    void draw(LedMask &mask, uint8_t *cover) const;
+
+   private:
+    /**
+     * @brief Next column of the text, the gap and the text again
+     */
+    uint8_t nextColumn();
+
+    char text[TEXT_MAX + 1] = "";
+    uint8_t length = 0;
+    char pending[TEXT_MAX + 1];
+    volatile bool hasPending = false;
+#ifdef BUILD_FOR_ESP32
+    portMUX_TYPE pendingLock = portMUX_INITIALIZER_UNLOCKED;  // Guards pending and hasPending
+#endif
+    uint8_t window[PLedGeometry::COLS] = {};  // Visible columns, window[head] at the left edge
+    uint8_t head = 0;
+    uint8_t charIndex = 0;  // Character of the next column, length: in the gap
+    uint8_t charCol = 0;    // Column in the character or the gap
+    uint16_t speed = DEFAULT_SPEED;
+    uint16_t fraction = 0;  // Part of a column in 1/256
+    uint16_t scrolled = 0;
+};
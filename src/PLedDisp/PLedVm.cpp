@@ -0,0 +1,363 @@
+/**
+ * @file PLedVm.cpp
+ * @date 2026-10-15
+ *
+ */
+
+#include "PLedVm.h"
+
+#include <string.h>
+
+namespace {
+const uint8_t PIXEL_ONLY = 0x01;  // Needs an LED
+const uint8_t COLOR = 0x02;       // Draws the LED, ends the pixel code
+
+struct OpInfo {
+    uint8_t valid;
+    uint8_t pops;
+    uint8_t pushes;
+    uint8_t operands;  // Immediate bytes
+    uint8_t flags;
+};
+
+struct OpTable {
+    OpInfo op[PLedVm::OP_COUNT];
+};
+
+constexpr OpTable makeOpTable() {
+    OpTable table = {};
+    table.op[PLedVm::PUSH] = {1, 0, 1, 1, 0};
+    table.op[PLedVm::PUSH16] = {1, 0, 1, 2, 0};
+    table.op[PLedVm::X] = {1, 0, 1, 0, PIXEL_ONLY};
+    table.op[PLedVm::Y] = {1, 0, 1, 0, PIXEL_ONLY};
+    table.op[PLedVm::LED] = {1, 0, 1, 0, PIXEL_ONLY};
+    table.op[PLedVm::T] = {1, 0, 1, 0, 0};
+    table.op[PLedVm::LOAD] = {1, 0, 1, 1, 0};
+    table.op[PLedVm::STORE] = {1, 1, 0, 1, 0};
+    table.op[PLedVm::DUP] = {1, 1, 2, 0, 0};
+    table.op[PLedVm::DROP] = {1, 1, 0, 0, 0};
+    table.op[PLedVm::SWAP] = {1, 2, 2, 0, 0};
+    for (uint8_t op = PLedVm::ADD; op <= PLedVm::EQ; op++) {
+        table.op[op] = {1, 2, 1, 0, 0};
+    }
+    table.op[PLedVm::NEG] = {1, 1, 1, 0, 0};
+    table.op[PLedVm::SEL] = {1, 3, 1, 0, 0};
+    table.op[PLedVm::SIN8] = {1, 1, 1, 0, 0};
+    table.op[PLedVm::SCALE8] = {1, 2, 1, 0, 0};
+    table.op[PLedVm::NOISE] = {1, 2, 1, 0, 0};
+    table.op[PLedVm::RAND] = {1, 0, 1, 0, 0};
+    table.op[PLedVm::HSV] = {1, 3, 0, 0, PIXEL_ONLY | COLOR};
+    table.op[PLedVm::RGB] = {1, 3, 0, 0, PIXEL_ONLY | COLOR};
+    return table;
+}
+
+constexpr OpTable OPS = makeOpTable();
+
+/**
+ * @brief Check one part of the code
+ *
+ * @param pixel - Pixel code, must end with a colour
+ * @param count - Instructions of the part
+ */
+PLedVm::Error validatePart(const uint8_t *code, uint8_t length, bool pixel, uint16_t *count) {
+    uint8_t depth = 0;
+    uint8_t pc = 0;
+    uint8_t flags = 0;
+    *count = 0;
+    while (pc < length) {
+        uint8_t op = code[pc++];
+        if ((op >= PLedVm::OP_COUNT) || !OPS.op[op].valid || (!pixel && (OPS.op[op].flags & PIXEL_ONLY))) {
+            return PLedVm::Error::BadOpcode;
+        }
+        if (flags & COLOR) {
+            return PLedVm::Error::Unbalanced;  // Instructions after the colour
+        }
+        flags = OPS.op[op].flags;
+        if (length - pc < OPS.op[op].operands) {
+            return PLedVm::Error::BadOperand;
+        }
+        if (((op == PLedVm::LOAD) || (op == PLedVm::STORE)) && (code[pc] >= PLedVm::REGISTERS)) {
+            return PLedVm::Error::BadOperand;
+        }
+        pc += OPS.op[op].operands;
+        if (depth < OPS.op[op].pops) {
+            return PLedVm::Error::Underflow;
+        }
+        depth = depth - OPS.op[op].pops + OPS.op[op].pushes;
+        if (depth > PLedVm::STACK_SIZE) {
+            return PLedVm::Error::Overflow;
+        }
+        (*count)++;
+    }
+    if ((depth != 0) || (pixel && !(flags & COLOR))) {
+        return PLedVm::Error::Unbalanced;
+    }
+    return PLedVm::Error::Ok;
+}
+
+inline uint8_t clamp8(int16_t value) {
+    return (value < 0) ? 0 : (value > 255) ? 255 : value;
+}
+
+inline uint8_t hash8(uint8_t x, uint8_t y) {
+    uint32_t h = x * 374761393UL + y * 668265263UL;
+    h = (h ^ (h >> 13)) * 1274126177UL;
+    return h >> 24;
+}
+
+inline uint8_t lerp8(uint8_t a, uint8_t b, uint8_t f) {
+    return a + (((b - a) * f) >> 8);
+}
+
+inline uint8_t smoothstep8(uint8_t f) {
+    return ((uint32_t)f * f * (765 - 2 * f)) >> 16;
+}
+}  // namespace
+
+PLedVm::Error PLedVm::validate(const uint8_t *program, uint16_t size, uint16_t *instructions) {
+    if ((size < HEADER_SIZE) || (program[0] != 'V') || (program[1] != FORMAT_VERSION)) {
+        return Error::BadHeader;
+    }
+    uint8_t frameLen = program[2];
+    uint8_t pixelLen = program[3];
+    if ((frameLen + pixelLen > CODE_MAX) || (HEADER_SIZE + frameLen + pixelLen != size)) {
+        return Error::TooLong;
+    }
+    uint16_t frameCount;
+    uint16_t pixelCount;
+    Error error = validatePart(program + HEADER_SIZE, frameLen, false, &frameCount);
+    if (error == Error::Ok) {
+        error = validatePart(program + HEADER_SIZE + frameLen, pixelLen, true, &pixelCount);
+    }
+    if (error != Error::Ok) {
+        return error;
+    }
+    uint32_t total = frameCount + (uint32_t)PLedGeometry::LED_COUNT * pixelCount;
+    if (total > INSTRUCTION_BUDGET) {
+        return Error::OverBudget;
+    }
+    if (instructions != nullptr) {
+        *instructions = total;
+    }
+    return Error::Ok;
+}
+
+PLedVm::Error PLedVm::load(const uint8_t *program, uint16_t size) {
+    Error error = validate(program, size);
+    if (error != Error::Ok) {
+        return error;
+    }
+#ifdef BUILD_FOR_ESP32
+    portENTER_CRITICAL(&stageLock);
+#endif
+    memcpy(staged, program + HEADER_SIZE, size - HEADER_SIZE);
+    stagedFrameLength = program[2];
+    stagedPixelLength = program[3];
+    pending = true;
+#ifdef BUILD_FOR_ESP32
+    portEXIT_CRITICAL(&stageLock);
+#endif
+    return Error::Ok;
+}
+
+void PLedVm::run(PLedLayer &layer, PLedRandom &rng) {
+    if (pending) {
+        // Code and lengths are taken over together, a load() on another task waits meanwhile
+#ifdef BUILD_FOR_ESP32
+        portENTER_CRITICAL(&stageLock);
+#endif
+        memcpy(code, staged, stagedFrameLength + stagedPixelLength);
+        frameLength = stagedFrameLength;
+        pixelLength = stagedPixelLength;
+        pending = false;
+#ifdef BUILD_FOR_ESP32
+        portEXIT_CRITICAL(&stageLock);
+#endif
+        memset(reg, 0, sizeof(reg));
+        time = 0;
+    }
+    if (pixelLength == 0) {
+        return;
+    }
+
+    exec(code, code + frameLength, 0, 0, PLedGeometry::SINK, layer, rng);
+    const uint8_t *pixel = code + frameLength;
+    for (uint8_t row = 0; row < PLedGeometry::ROWS; row++) {
+        for (uint8_t col = PLedGeometry::firstCol(row); col <= PLedGeometry::lastCol(row); col++) {
+            uint8_t led = PLedGeometry::address(row, col);
+            if (led != PLedGeometry::NO_LED) {
+                exec(pixel, pixel + pixelLength, row, col, led, layer, rng);
+            }
+        }
+    }
+    layer.dirty = true;
+    time++;
+}
+
+uint8_t PLedVm::noise8(uint16_t x, uint16_t y) {
+    uint8_t cx = x >> 8;
+    uint8_t cy = y >> 8;
+    uint8_t fx = smoothstep8(x & 0xFF);
+    uint8_t fy = smoothstep8(y & 0xFF);
+    uint8_t top = lerp8(hash8(cx, cy), hash8(cx + 1, cy), fx);
+    uint8_t bottom = lerp8(hash8(cx, cy + 1), hash8(cx + 1, cy + 1), fx);
+    return lerp8(top, bottom, fy);
+}
+
+const char *PLedVm::errorText(Error error) {
+    switch (error) {
+        case Error::Ok:
+            return "ok";
+        case Error::BadHeader:
+            return "no program of this format version";
+        case Error::TooLong:
+            return "code too long or size wrong";
+        case Error::BadOpcode:
+            return "unknown instruction or LED instruction in frame code";
+        case Error::BadOperand:
+            return "missing immediate or bad register";
+        case Error::Underflow:
+            return "stack underflow";
+        case Error::Overflow:
+            return "stack overflow";
+        case Error::Unbalanced:
+            return "values left on the stack or pixel code without colour at the end";
+        case Error::OverBudget:
+            return "too many instructions per step";
+    }
+    return "?";
+}
+
+//=====PRIVATE====================================================================================
+void PLedVm::exec(const uint8_t *pc, const uint8_t *end, uint8_t row, uint8_t col, uint8_t led, PLedLayer &layer,
+                  PLedRandom &rng) {
+    int16_t stack[STACK_SIZE + 1];
+    int16_t *sp = stack;  // Next free entry, the top is sp[-1]
+    int16_t b;
+    while (pc < end) {
+        switch (*pc++) {
+            case PUSH:
+                *sp++ = *pc++;
+                break;
+            case PUSH16:
+                *sp++ = (int16_t)(pc[0] | (pc[1] << 8));
+                pc += 2;
+                break;
+            case X:
+                *sp++ = col;
+                break;
+            case Y:
+                *sp++ = row;
+                break;
+            case LED:
+                *sp++ = led;
+                break;
+            case T:
+                *sp++ = (int16_t)time;
+                break;
+            case LOAD:
+                *sp++ = reg[*pc++];
+                break;
+            case STORE:
+                reg[*pc++] = *--sp;
+                break;
+            case DUP:
+                *sp = sp[-1];
+                sp++;
+                break;
+            case DROP:
+                sp--;
+                break;
+            case SWAP:
+                b = sp[-1];
+                sp[-1] = sp[-2];
+                sp[-2] = b;
+                break;
+            case ADD:
+                b = *--sp;
+                sp[-1] = (int16_t)(sp[-1] + b);
+                break;
+            case SUB:
+                b = *--sp;
+                sp[-1] = (int16_t)(sp[-1] - b);
+                break;
+            case MUL:
+                b = *--sp;
+                sp[-1] = (int16_t)(sp[-1] * b);
+                break;
+            case DIV:
+                b = *--sp;
+                sp[-1] = (b != 0) ? (int16_t)(sp[-1] / b) : 0;
+                break;
+            case MOD:
+                b = *--sp;
+                sp[-1] = (b != 0) ? (int16_t)(sp[-1] % b) : 0;
+                break;
+            case NEG:
+                sp[-1] = (int16_t)-sp[-1];
+                break;
+            case AND:
+                b = *--sp;
+                sp[-1] &= b;
+                break;
+            case OR:
+                b = *--sp;
+                sp[-1] |= b;
+                break;
+            case XOR:
+                b = *--sp;
+                sp[-1] ^= b;
+                break;
+            case SHL:
+                b = *--sp;
+                sp[-1] = (int16_t)((uint16_t)sp[-1] << (b & 15));
+                break;
+            case SHR:
+                b = *--sp;
+                sp[-1] = sp[-1] >> (b & 15);
+                break;
+            case MIN:
+                b = *--sp;
+                sp[-1] = (b < sp[-1]) ? b : sp[-1];
+                break;
+            case MAX:
+                b = *--sp;
+                sp[-1] = (b > sp[-1]) ? b : sp[-1];
+                break;
+            case LT:
+                b = *--sp;
+                sp[-1] = sp[-1] < b;
+                break;
+            case EQ:
+                b = *--sp;
+                sp[-1] = sp[-1] == b;
+                break;
+            case SEL:
+                sp -= 2;
+                sp[-1] = (sp[-1] != 0) ? sp[0] : sp[1];
+                break;
+            case SIN8:
+                sp[-1] = sin8(sp[-1] & 0xFF);
+                break;
+            case SCALE8:
+                b = *--sp;
+                sp[-1] = ((sp[-1] & 0xFF) * (b & 0xFF)) >> 8;
+                break;
+            case NOISE:
+                b = *--sp;
+                sp[-1] = noise8(sp[-1], b);
+                break;
+            case RAND:
+                *sp++ = rng.random8();
+                break;
+            case HSV:
+                sp -= 3;
+                layer.put(led, CHSV(sp[0] & 0xFF, clamp8(sp[1]), clamp8(sp[2])));
+                break;
+            case RGB:
+                sp -= 3;
+                layer.put(led, CRGB(clamp8(sp[0]), clamp8(sp[1]), clamp8(sp[2])));
+                break;
+        }
+    }
+}
@@ -0,0 +1,155 @@
+/**
+ * @file PLedVm.h
+ * @brief Stack machine for user-defined background effects
+ *
+ * A program is uploaded as bytecode and consists of a frame part, run once per animation step,
+ * and a pixel part, run for every LED and ending with the colour of the LED. There are no jumps,
+ * so every instruction runs exactly once per pass: load() checks opcodes, stack depth and the
+ * instructions per step against INSTRUCTION_BUDGET once, and run() needs no checks at all.
+ * Conditions are computed branch free with LT/EQ and SEL. Values are 16 bit signed, the
+ * registers keep their values between steps. Programs are written as text and assembled with
+ * tools/vmasm.py, which also lists the instructions.
+ *
+ * Format: 'V' version frameLength pixelLength, frame code, pixel code
+ *
+ * @date 2026-10-15
+ */
+
+#pragma once
+
+#include <FastLED.h>
+
+#include "PLedCompositor.h"
+#include "PLedGeometry.h"
+#include "PLedRandom.h"
+
+class PLedVm {
+   public:
+    static const uint8_t FORMAT_VERSION = 1;
+    static const uint8_t HEADER_SIZE = 4;
+    static const uint8_t CODE_MAX = 255;      // Max. bytes of frame and pixel code together
+    static const uint8_t STACK_SIZE = 16;
+    static const uint8_t REGISTERS = 8;
+    static const uint16_t INSTRUCTION_BUDGET = 8192;  // Max. instructions per step, frame + LED_COUNT * pixel
+
+    /**
+     * @brief Instructions, (a b -- c) pops b then a and pushes c
+     */
+    enum Op : uint8_t {
+        PUSH = 0x01,    // ( -- imm8) one byte immediate 0--255
+        PUSH16 = 0x02,  // ( -- imm16) two byte immediate, little endian
+        X = 0x03,       // ( -- col) column of the LED 0--19, pixel code only
+        Y = 0x04,       // ( -- row) row of the LED 0--6, pixel code only
+        LED = 0x05,     // ( -- led) strip index of the LED 0--127, pixel code only
+        T = 0x06,       // ( -- t) animation steps since the program was loaded
+        LOAD = 0x07,    // ( -- reg) one byte register number
+        STORE = 0x08,   // (a -- ) one byte register number
+        DUP = 0x09,     // (a -- a a)
+        DROP = 0x0A,    // (a -- )
+        SWAP = 0x0B,    // (a b -- b a)
+        ADD = 0x10,     // (a b -- a+b)
+        SUB = 0x11,     // (a b -- a-b)
+        MUL = 0x12,     // (a b -- a*b)
+        DIV = 0x13,     // (a b -- a/b) 0 if b is 0
+        MOD = 0x14,     // (a b -- a%b) 0 if b is 0
+        NEG = 0x15,     // (a -- -a)
+        AND = 0x16,     // (a b -- a&b)
+        OR = 0x17,      // (a b -- a|b)
+        XOR = 0x18,     // (a b -- a^b)
+        SHL = 0x19,     // (a b -- a<<b) b & 15
+        SHR = 0x1A,     // (a b -- a>>b) b & 15, arithmetic
+        MIN = 0x1B,     // (a b -- min)
+        MAX = 0x1C,     // (a b -- max)
+        LT = 0x1D,      // (a b -- a<b) 1 or 0
+        EQ = 0x1E,      // (a b -- a==b) 1 or 0
+        SEL = 0x1F,     // (c a b -- c?a:b)
+        SIN8 = 0x20,    // (a -- sin) sine of a & 255 as one period, 0--255
+        SCALE8 = 0x21,  // (a b -- a*b/256) of a & 255 and b & 255
+        NOISE = 0x22,   // (x y -- n) smooth value noise 0--255, x and y in 1/256 of a cell
+        RAND = 0x23,    // ( -- r) random number 0--255
+        HSV = 0x30,     // (h s v -- ) colour of the LED, last instruction of the pixel code
+        RGB = 0x31,     // (r g b -- ) colour of the LED, last instruction of the pixel code
+        OP_COUNT
+    };
+
+    enum class Error : uint8_t { Ok,
+                                 BadHeader,    // Not 'V' or other format version
+                                 TooLong,      // Code longer than CODE_MAX or than the upload
+                                 BadOpcode,    // Unknown instruction or pixel only instruction in the frame code
+                                 BadOperand,   // Immediate missing or register number too large
+                                 Underflow,    // Instruction pops more than is on the stack
+                                 Overflow,     // More than STACK_SIZE values
+                                 Unbalanced,   // Code leaves values, or the pixel code doesn't end with its colour
+                                 OverBudget    // More than INSTRUCTION_BUDGET instructions per step
+    };
+
+    /**
+     * @brief Check a program and count its instructions per step
+     *
+     * @param program - Header and code
+     * @param size - Bytes of program
+     * @param instructions - Instructions per step if Ok, may be nullptr
+     * @return Error - Error::Ok if the program may be loaded
+     */
+    static Error validate(const uint8_t *program, uint16_t size, uint16_t *instructions = nullptr);
+
+    /**
+     * @brief Check a program and run it from the next step on, instead of the current one
+     *
+     * Safe while another task renders: the program is copied aside and taken over at the start
+     * of the next run(), with cleared registers and time. On the ESP32 both copies run in a
+     * critical section, so run() never takes over a program half written.
+     *
+     * @param program - Header and code, may be released after the call
+     * @param size - Bytes of program
+     * @return Error - Error::Ok if loaded, otherwise the current program keeps running
+     */
+    Error load(const uint8_t *program, uint16_t size);
+
+    inline bool isLoaded() const {
+        return (pixelLength != 0) || pending;
+    }
+
+    /**
+     * @brief Run the program for one step, the frame code once and the pixel code for all LED's
+     *
+     * @param layer - Layer the LED's are drawn on
+     * @param rng - Random numbers of RAND
+     */
+    void run(PLedLayer &layer, PLedRandom &rng);
+
+    /**
+     * @brief Smooth 2D value noise
+     *
+     * @param x - Position in 1/256 of a cell
+     * @param y - Position in 1/256 of a cell
+     * @return uint8_t - 0--255
+     */
+    static uint8_t noise8(uint16_t x, uint16_t y);
+
+    static const char *errorText(Error error);
+
+   private:
+    /**
+     * @brief Run validated code on an empty stack
+     *
+     * @param row - Row of the LED, unused by the frame code
+     * @param col - Column of the LED
+     * @param led - LED the colour instructions draw, PLedGeometry::SINK for the frame code
+     */
+    void exec(const uint8_t *pc, const uint8_t *end, uint8_t row, uint8_t col, uint8_t led, PLedLayer &layer,
+              PLedRandom &rng);
+
+    uint8_t code[CODE_MAX];
+    uint8_t frameLength = 0;
+    uint8_t pixelLength = 0;  // 0: no program
+    uint8_t staged[CODE_MAX];
+    uint8_t stagedFrameLength = 0;
+    uint8_t stagedPixelLength = 0;
+    volatile bool pending = false;  // staged waits for the next run()
+#ifdef BUILD_FOR_ESP32
+    portMUX_TYPE stageLock = portMUX_INITIALIZER_UNLOCKED;  // Guards staged, its lengths and pending
+#endif
+    int16_t reg[REGISTERS] = {};
+    uint16_t time = 0;
+};
@@ -14,6 +14,7 @@
  */
 
 #include <Arduino.h>
+#include <LittleFS.h>
 #include <NTPClient.h>
 #include <Timezone.h>  // https://github.com/JChristensen/Timezone
 #include <WiFi.h>
@@ -57,6 +58,11 @@ TimeChangeRule CET = {"CET ", Last, Sun, Oct, 3, 60};    // Central European Sta
 Timezone CE(CEST, CET);
 
 PLedDisp* pleddisp;  ///< Instance
+const char* CLIP_FILE = "/clip.plc";  ///< Clip on LittleFS played instead of the built-in one, see tools/clipc.py
+PLedFileClip* fileClip = nullptr;
+const uint16_t ROUTINE_FADE_MS = 2000;  ///< [ms] Crossfade when the routine of the day changes
+const uint16_t TIMER_FADE_MS = 500;     ///< [ms] Crossfade of the timer frame colours
+const char* RecyclingReminder = nullptr;  ///< Recycling of tomorrow, scrolled with the time in the evening
 bool SleepActive;
 
 //===RTOS===
@@ -124,6 +130,20 @@ enum class Recycling { None,
  */
 enum Recycling CheckDateForRecycling();
 
+/**
+ * @brief Serial upload of a background program as assembled by tools/vmasm.py, it starts with 'V'
+ * Answers with one line, whether the program runs or why it was rejected
+ */
+void CheckProgramUpload();
+
+#ifdef PLED_PROFILING
+/**
+ * @brief Serial commands for the render profiling of the display:
+ * 'p' prints the stage timings, 'd' writes them as binary dump, 'r' resets them
+ */
+void CheckProfilingCommand();
+#endif
+
 //==============================================================================================
 unsigned long currentMillis = 0;           ///< Current time for non blocking delay
 unsigned long previousMillisMovement = 0;  ///< Last time called for non blocking delay
@@ -317,19 +337,17 @@ void TaskMainCode(void* pvParameters) {
 
 /**
  * Task for updating display
- * Runs every 50ms on core 0
+ * Runs at the refresh rate of the display (every 50ms, faster while dithering) on core 0
  */
 void TaskLcdCode(void* pvParameters) {
     DBPrint("TaskLcdCode running on core ");
     DBPrintln(xPortGetCoreID());
 
-    const TickType_t xFrequency = 50;  // ms
     TickType_t xLastWakeTime = xTaskGetTickCount();
 
     for (;;) {
-        // Wait for the next cycle
-        xLastWakeTime = xTaskGetTickCount();
-        vTaskDelayUntil(&xLastWakeTime, xFrequency);
+        // Wait for the next cycle, relative to the last wake up to keep a fixed period
+        vTaskDelayUntil(&xLastWakeTime, pdMS_TO_TICKS(1000 / pleddisp->getRefreshRate()));
 
         pleddisp->update_LEDs();
     }
@@ -339,6 +357,11 @@ void TaskLcdCode(void* pvParameters) {
  * ideal task
  */
 void loop() {
+    CheckProgramUpload();
+#ifdef PLED_PROFILING
+    CheckProfilingCommand();
+#endif
+    delay(100);
 }
 
 //==============================================================================================
@@ -358,13 +381,17 @@ void UpdateSerialSma() {
                 Serial.println("'T' time");
                 Serial.println("'R' rainbow time");
                 Serial.println("'C' cycle through all digits");
+                Serial.println("'S' scrolling text");
+                Serial.println("'L' date as label");
             }
 
             mode_fg = Serial.read();
             if (((mode_fg == 'N') or (mode_fg == 'n')) or
                 ((mode_fg == 'T') or (mode_fg == 't')) or
                 ((mode_fg == 'R') or (mode_fg == 'r')) or
-                ((mode_fg == 'C') or (mode_fg == 'c'))) {
+                ((mode_fg == 'C') or (mode_fg == 'c')) or
+                ((mode_fg == 'S') or (mode_fg == 's')) or
+                ((mode_fg == 'L') or (mode_fg == 'l'))) {
                 Serial.println(mode_fg);
                 SmaSerial.actualState = uint(StateSerial::SetFrame);
             }
@@ -395,6 +422,8 @@ void UpdateSerialSma() {
                 Serial.println("'F' Fireworks");
                 Serial.println("'T' Thunderstorm");
                 Serial.println("'P' Firepit");
+                Serial.println("'C' Animation clip");
+                Serial.println("'U' Uploaded bytecode program");
             }
 
             mode_bg = Serial.read();
@@ -404,7 +433,9 @@ void UpdateSerialSma() {
                 ((mode_bg == 'W') or (mode_bg == 'w')) or
                 ((mode_bg == 'F') or (mode_bg == 'f')) or
                 ((mode_bg == 'T') or (mode_bg == 't')) or
-                ((mode_bg == 'P') or (mode_bg == 'p'))) {
+                ((mode_bg == 'P') or (mode_bg == 'p')) or
+                ((mode_bg == 'C') or (mode_bg == 'c')) or
+                ((mode_bg == 'U') or (mode_bg == 'u'))) {
                 Serial.println(mode_bg);
                 SmaSerial.actualState = uint(StateSerial::Update);
             }
@@ -432,6 +463,20 @@ void UpdateSerialSma() {
                     Serial.println("FG: Cycle");
                     pleddisp->setForegroundMode(PLedDisp::ModeFG::Cycle);
                     break;
+                case 'S':
+                case 's':
+                    Serial.println("FG: Text");
+                    pleddisp->setForegroundMode(PLedDisp::ModeFG::Text);
+                    break;
+                case 'L':
+                case 'l': {
+                    Serial.println("FG: Label");
+                    char label[PLedLayout::TEXT_MAX + 1];
+                    snprintf(label, sizeof(label), "%02u.%02u", TIME_NOW.day(), TIME_NOW.month());
+                    pleddisp->setLabel(label);
+                    pleddisp->setForegroundMode(PLedDisp::ModeFG::Label);
+                    break;
+                }
                 default:
                     Serial.println(mode_fg);
                     Serial.println("FG: DEFAULT");
@@ -496,6 +541,19 @@ void UpdateSerialSma() {
                     Serial.println("BG: Firepit");
                     pleddisp->setBackgroundMode(PLedDisp::ModeBG::Firepit);
                     break;
+                case 'C':
+                case 'c':
+                    Serial.println("BG: Clip");
+                    if ((fileClip == nullptr) && LittleFS.begin() && LittleFS.exists(CLIP_FILE)) {
+                        fileClip = new PLedFileClip(LittleFS.open(CLIP_FILE));
+                    }
+                    pleddisp->playClip(fileClip);  // The built-in clip if there is no valid file
+                    break;
+                case 'U':
+                case 'u':
+                    Serial.println("BG: Program");
+                    pleddisp->setBackgroundMode(PLedDisp::ModeBG::Program);
+                    break;
                 default:
                     Serial.println(mode_bg);
                     Serial.println("BG: DEFAULT");
@@ -509,6 +567,48 @@ void UpdateSerialSma() {
     }
 }
 
+void CheckProgramUpload() {
+    if (Serial.peek() != 'V') {
+        return;
+    }
+    uint8_t program[PLedVm::HEADER_SIZE + PLedVm::CODE_MAX];
+    size_t size = Serial.readBytes(program, PLedVm::HEADER_SIZE);
+    if (size == PLedVm::HEADER_SIZE) {
+        size_t length = program[2] + program[3];
+        if (length <= PLedVm::CODE_MAX) {
+            size += Serial.readBytes(program + PLedVm::HEADER_SIZE, length);
+        }
+    }
+    PLedVm::Error error = pleddisp->loadProgram(program, size);
+    Serial.print("VM: ");
+    Serial.println(PLedVm::errorText(error));
+}
+
+#ifdef PLED_PROFILING
+void CheckProfilingCommand() {
+    // Only take the command bytes, anything else (e.g. the 'V' of an upload) stays for its reader
+    int command = Serial.peek();
+    if ((command != 'p') && (command != 'd') && (command != 'r')) {
+        return;
+    }
+    Serial.read();
+    switch (command) {
+        case 'p':
+            pleddisp->getProfiler().report(Serial);
+            break;
+        case 'd':
+            pleddisp->getProfiler().dump(Serial);
+            break;
+        case 'r':
+            pleddisp->getProfiler().reset();
+            Serial.println("Profiling reset");
+            break;
+        default:
+            break;
+    }
+}
+#endif
+
 void UpdateTimeSma() {
     uint timeSecondsPassedInDay = TIME_NOW.unixtime() % TIME_DAYINSECONDS;
     // uint timeSecondsPassedInDay = uindebugTimeMs % TIME_DAYINSECONDS;
@@ -542,6 +642,10 @@ void UpdateTimeSma() {
         DBPrintln(SmaTime.actualState);
         DBPrintln(timeSecondsPassedInDay);
         DBPrintln(timeSecondsPassedInDay / 60.0 / 60);
+
+        // Low night brightness needs the dithering to avoid banding and muddy colours, a black
+        // display at night is not sent again
+        pleddisp->setTemporalDithering(SmaTime.actualState == uint(StateTime::Night));
     }
 
     switch (SmaTime.actualState) {
@@ -560,9 +664,9 @@ void UpdateTimeSma() {
                 DBPrintln("StateTime::Morning");
                 NbrRepeatTrainAnimation = 0;
 
-                pleddisp->setBackgroundMode(PLedDisp::ModeBG::None);
-                pleddisp->setFrameMode(PLedDisp::ModeFR::None);
-                pleddisp->setForegroundMode(PLedDisp::ModeFG::Time, true);
+                pleddisp->setBackgroundMode(PLedDisp::ModeBG::None, ROUTINE_FADE_MS);
+                pleddisp->setFrameMode(PLedDisp::ModeFR::None, ROUTINE_FADE_MS);
+                pleddisp->setForegroundMode(PLedDisp::ModeFG::Time, true, ROUTINE_FADE_MS);
             }
             pleddisp->setBrightness(brightnessHigh);
 
@@ -582,12 +686,12 @@ void UpdateTimeSma() {
             if (SmaTime.doInitAction) {
                 DBPrintln("StateTime::Day");
 
-                pleddisp->setBackgroundMode(PLedDisp::ModeBG::None);
-                pleddisp->setFrameMode(PLedDisp::ModeFR::None);
+                pleddisp->setBackgroundMode(PLedDisp::ModeBG::None, ROUTINE_FADE_MS);
+                pleddisp->setFrameMode(PLedDisp::ModeFR::None, ROUTINE_FADE_MS);
                 if (DayIsWeekend) {
-                    pleddisp->setForegroundMode(PLedDisp::ModeFG::Time, true);
+                    pleddisp->setForegroundMode(PLedDisp::ModeFG::Time, true, ROUTINE_FADE_MS);
                 } else {
-                    pleddisp->setForegroundMode(PLedDisp::ModeFG::Time, true);
+                    pleddisp->setForegroundMode(PLedDisp::ModeFG::Time, true, ROUTINE_FADE_MS);
                 }
             }
             pleddisp->setBrightness(brightnessHigh);
@@ -598,22 +702,35 @@ void UpdateTimeSma() {
                 DBPrintln("StateTime::Evening");
 
                 // Check for ToDoTasks for the next day
+                RecyclingReminder = nullptr;
                 switch (CheckDateForRecycling()) {
                     case Recycling::Cardboard:
-                        pleddisp->setFrameMode(PLedDisp::ModeFR::SolidColor);
-                        pleddisp->setFrameColor(CRGB::Beige);
+                        pleddisp->setFrameMode(PLedDisp::ModeFR::SolidColor, ROUTINE_FADE_MS);
+                        pleddisp->setFrameColor(CRGB::Beige, ROUTINE_FADE_MS);
+                        RecyclingReminder = "Cardboard tomorrow";
                         break;
                     case Recycling::Paper:
-                        pleddisp->setFrameMode(PLedDisp::ModeFR::SolidColor);
-                        pleddisp->setFrameColor(CRGB::WhiteSmoke);
+                        pleddisp->setFrameMode(PLedDisp::ModeFR::SolidColor, ROUTINE_FADE_MS);
+                        pleddisp->setFrameColor(CRGB::WhiteSmoke, ROUTINE_FADE_MS);
+                        RecyclingReminder = "Paper tomorrow";
                         break;
                     case Recycling::Metal:
-                        pleddisp->setFrameMode(PLedDisp::ModeFR::SolidColor);
-                        pleddisp->setFrameColor(CRGB::MediumBlue);
+                        pleddisp->setFrameMode(PLedDisp::ModeFR::SolidColor, ROUTINE_FADE_MS);
+                        pleddisp->setFrameColor(CRGB::MediumBlue, ROUTINE_FADE_MS);
+                        RecyclingReminder = "Metal tomorrow";
                         break;
                     default:
                         break;
                 };
+                if (RecyclingReminder != nullptr) {
+                    pleddisp->setForegroundMode(PLedDisp::ModeFG::Text, true, ROUTINE_FADE_MS);
+                }
+            }
+            if (RecyclingReminder != nullptr) {
+                // The time scrolls with the reminder, a new text starts after the current one
+                char text[PLedText::TEXT_MAX + 1];
+                snprintf(text, sizeof(text), "%02u:%02u %s", TIME_NOW.hour(), TIME_NOW.minute(), RecyclingReminder);
+                pleddisp->setText(text);
             }
             pleddisp->setBrightness(brightnessHigh);
 
@@ -622,9 +739,9 @@ void UpdateTimeSma() {
             if (SmaTime.doInitAction) {
                 DBPrintln("StateTime::Night");
                 // Turn off
-                pleddisp->setBackgroundMode(PLedDisp::ModeBG::None);
-                pleddisp->setFrameMode(PLedDisp::ModeFR::None);
-                pleddisp->setForegroundMode(PLedDisp::ModeFG::None, true);
+                pleddisp->setBackgroundMode(PLedDisp::ModeBG::None, ROUTINE_FADE_MS);
+                pleddisp->setFrameMode(PLedDisp::ModeFR::None, ROUTINE_FADE_MS);
+                pleddisp->setForegroundMode(PLedDisp::ModeFG::None, true, ROUTINE_FADE_MS);
             }
             pleddisp->setBrightness(brightnessLow);
 
@@ -646,21 +763,21 @@ bool SetTimerAnimation(uint timeSecondsPassedInDay, uint timeSecondsTimerEnds) {
 
     if (timeSecondsTimerEnds < timeSecondsPassedInDay) {
         // Timer endet
-        pleddisp->setFrameMode(PLedDisp::ModeFR::None);
+        pleddisp->setFrameMode(PLedDisp::ModeFR::None, TIMER_FADE_MS);
         return true;
     }
 
     int timeLeft = timeSecondsTimerEnds - timeSecondsPassedInDay;
 
     if (timeLeft < timeLeftIndicator3) {
-        pleddisp->setFrameMode(PLedDisp::ModeFR::Time);
-        pleddisp->setFrameColor(CRGB::Red);
+        pleddisp->setFrameMode(PLedDisp::ModeFR::Time, TIMER_FADE_MS);
+        pleddisp->setFrameColor(CRGB::Red, TIMER_FADE_MS);
     } else if (timeLeft < timeLeftIndicator2) {
-        pleddisp->setFrameMode(PLedDisp::ModeFR::Time);
-        pleddisp->setFrameColor(CRGB::DarkOrange);
+        pleddisp->setFrameMode(PLedDisp::ModeFR::Time, TIMER_FADE_MS);
+        pleddisp->setFrameColor(CRGB::DarkOrange, TIMER_FADE_MS);
     } else if (timeLeft < timeLeftIndicator1) {
-        pleddisp->setFrameMode(PLedDisp::ModeFR::Time);
-        pleddisp->setFrameColor(CRGB::LightBlue);
+        pleddisp->setFrameMode(PLedDisp::ModeFR::Time, TIMER_FADE_MS);
+        pleddisp->setFrameColor(CRGB::LightBlue, TIMER_FADE_MS);
     }
 
     return false;
@@ -0,0 +1,401 @@
+// Golden frames of test_golden, FNV-1a hash per frame. Generated, do not edit.
+#pragma once
+
+static const uint64_t GOLDEN_FRAMES[22][64] = {
+    // bg None
+    {
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,},
+    // bg SolidColor
+    {
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL,},
+    // bg ScrollingRainbow
+    {
+        0x582731035c21dbcaULL, 0x582731035c21dbcaULL, 0x582731035c21dbcaULL, 0x582731035c21dbcaULL,
+        0x582731035c21dbcaULL, 0x6da9a644a3c898c7ULL, 0x6da9a644a3c898c7ULL, 0x6da9a644a3c898c7ULL,
+        0x6da9a644a3c898c7ULL, 0x6da9a644a3c898c7ULL, 0x6da9a644a3c898c7ULL, 0x5785ab8745840ecbULL,
+        0x5785ab8745840ecbULL, 0x5785ab8745840ecbULL, 0x5785ab8745840ecbULL, 0x5785ab8745840ecbULL,
+        0x5785ab8745840ecbULL, 0x53a9801c28c278c1ULL, 0x53a9801c28c278c1ULL, 0x53a9801c28c278c1ULL,
+        0x53a9801c28c278c1ULL, 0x53a9801c28c278c1ULL, 0x53a9801c28c278c1ULL, 0x70682b7008415e30ULL,
+        0x70682b7008415e30ULL, 0x70682b7008415e30ULL, 0x70682b7008415e30ULL, 0x70682b7008415e30ULL,
+        0x70682b7008415e30ULL, 0xde90df961bf42f93ULL, 0xde90df961bf42f93ULL, 0xde90df961bf42f93ULL,
+        0xde90df961bf42f93ULL, 0xde90df961bf42f93ULL, 0xde90df961bf42f93ULL, 0xf6520b6b7f29a7bdULL,
+        0xf6520b6b7f29a7bdULL, 0xf6520b6b7f29a7bdULL, 0xf6520b6b7f29a7bdULL, 0xf6520b6b7f29a7bdULL,
+        0xf6520b6b7f29a7bdULL, 0x873d22dc47a5da75ULL, 0x873d22dc47a5da75ULL, 0x873d22dc47a5da75ULL,
+        0x873d22dc47a5da75ULL, 0x873d22dc47a5da75ULL, 0x873d22dc47a5da75ULL, 0xdea3eb3deeebac9eULL,
+        0xdea3eb3deeebac9eULL, 0xdea3eb3deeebac9eULL, 0xdea3eb3deeebac9eULL, 0xdea3eb3deeebac9eULL,
+        0xdea3eb3deeebac9eULL, 0x1bf362d1a254fe68ULL, 0x1bf362d1a254fe68ULL, 0x1bf362d1a254fe68ULL,
+        0x1bf362d1a254fe68ULL, 0x1bf362d1a254fe68ULL, 0x1bf362d1a254fe68ULL, 0xa9d86b73c86132c6ULL,
+        0xa9d86b73c86132c6ULL, 0xa9d86b73c86132c6ULL, 0xa9d86b73c86132c6ULL, 0xa9d86b73c86132c6ULL,},
+    // bg Twinkle
+    {
+        0x845e68d6e9de0003ULL, 0x914246aa7176d21bULL, 0xb31ca287c7a84473ULL, 0x631cf1dd389a0393ULL,
+        0xd1df210f8278b96bULL, 0xa92d6dd8085e8c1bULL, 0x5755f17d6d47168bULL, 0x7c623013769992dbULL,
+        0x27640f2e11e1abf3ULL, 0x81ce71c8734c1e6bULL, 0x9a6a93ffd66973c3ULL, 0xd5ba305caee52c03ULL,
+        0x9ea7ae5803f0103bULL, 0xadcccf52b20fc4f3ULL, 0xb0981a2b8a7d662bULL, 0x25ef85634b9321a3ULL,
+        0xc01160760b09a31bULL, 0xa8f6d9d066ffcaebULL, 0x88d38e82fb37fddbULL, 0x8b04058289339bebULL,
+        0xd4ad1c17978e3603ULL, 0xf6c16e7dbdbad3cbULL, 0xf4dda9e688b1512bULL, 0x9c8f3929ca69694bULL,
+        0x632b0db05853e6abULL, 0x6a21986681e8919bULL, 0xff9879ec137030cbULL, 0x53cdd4115a288263ULL,
+        0xfeeac1fa1a22a943ULL, 0x4dabde1aa1aa13dbULL, 0x874bf095aa2e42bbULL, 0x20aa45451376627bULL,
+        0x23ed6f0a7922821bULL, 0xc6d8d0c271453383ULL, 0xab409b5bb9953c8bULL, 0x714c404e7593bf03ULL,
+        0x660e3a49202639d3ULL, 0xd2a79fa371bfab13ULL, 0x826f1fc3c055a8a3ULL, 0x2b529f6c36531c73ULL,
+        0x274d66219c567a1bULL, 0xcf73b542bbb236c3ULL, 0xef33520d82260d53ULL, 0x49859e41f2df4e83ULL,
+        0xee5327cbbdf957b3ULL, 0x4ce12dfe4a8aa5bbULL, 0xd3196714612ff64bULL, 0x0dd61c24b99f485bULL,
+        0x5016b6b02f7b6a4bULL, 0x36a9d9dccce7d6fbULL, 0xc5d5b9e485e94b93ULL, 0x1a6b60abd813b323ULL,
+        0x06090fbceb0fc2fbULL, 0x33542058735143b3ULL, 0xf9b45a8f4d883d63ULL, 0x1c84f228ba4240bbULL,
+        0x26a42800ab3cc393ULL, 0x96f9ab1561586e83ULL, 0x7567791ad2bc080bULL, 0x4c74e232cc33277bULL,
+        0x18790e25f220720bULL, 0x70d780503365f473ULL, 0x94e183015d1e62e3ULL, 0x5a3bd61828b34b53ULL,},
+    // bg Fireworks
+    {
+        0xfca97dbcf5556020ULL, 0xb0444aaaa5026a5eULL, 0xaf5e03910f3948aeULL, 0x9e3327e13f289510ULL,
+        0xcb5687b7d1ae6253ULL, 0xaad8706db47c9ccbULL, 0xc13462bef10c884fULL, 0xc13462bef10c884fULL,
+        0x64dfc81a5a25b353ULL, 0x124113b681e9ffe4ULL, 0x951fd47cb455d9c1ULL, 0xc386d02bae55ecffULL,
+        0x079a94fd0d9d38b8ULL, 0x6557add0425396f6ULL, 0xcbf4f1a07e5c2eb8ULL, 0x161fcd6840ce7f09ULL,
+        0x59c489a0d17662b3ULL, 0xcc4a9b1c4b888de6ULL, 0x66f5075c9b2c305dULL, 0x5b570446859150a3ULL,
+        0x7d3fd81e31883f30ULL, 0x7c9d46687be496a8ULL, 0x9f38a6b571d6b679ULL, 0xe8e2e11abde22343ULL,
+        0x4bd4a523b49652eeULL, 0x78464485461e6908ULL, 0xe4101efb45982248ULL, 0xb9aa42a3863ae3f6ULL,
+        0xf53c5b4524fb94ffULL, 0xa6a2cdd7232ed323ULL, 0xf41f527950827537ULL, 0xaf22621545e40ae7ULL,
+        0x19629df31e6b78e7ULL, 0x8c70913061e18667ULL, 0x7098b63c1c959abcULL, 0xe5b357f510a89a20ULL,
+        0x9551ee738191550aULL, 0xa80115d9f4710a31ULL, 0x558605ef3e1cf0fbULL, 0x7b6064d5039204eeULL,
+        0x09fdfd8aed8259eaULL, 0xa6c6f98eeca82d0eULL, 0xed1a6107e767d02bULL, 0xdb9b4a07ddb2b91eULL,
+        0x84d7a84cd2e912aeULL, 0x0c734ef21ef612b3ULL, 0x1c76c4eb51546c93ULL, 0x5bc8458137e318dbULL,
+        0x37e0c66b8e080557ULL, 0xff3efe9b930c758fULL, 0x820c10b66556d70bULL, 0x035764fed1a0ed56ULL,
+        0x47e4475f45b3c138ULL, 0x4247245a076e0a10ULL, 0xa5233394a2c2701eULL, 0x3754e82ef60d8fe6ULL,
+        0xed539ea2a9fdb913ULL, 0x892cd969dfe75cf0ULL, 0x88d354d323a94c97ULL, 0x9771f415a19c0b5bULL,
+        0x90842539d5dab627ULL, 0xbeeb0b96d3832183ULL, 0x2425fbf57633a1cbULL, 0x8471f2e450a94402ULL,},
+    // bg Thunderstorm
+    {
+        0xbb6d7c4b4692dd3fULL, 0xbcaca57238825f2bULL, 0xa5e5cc900fb88d02ULL, 0x799c8194e5b47464ULL,
+        0x95ea545132b609f8ULL, 0x60b3b0ea1e61679eULL, 0xc54fa20bc4e9bd82ULL, 0x9a428e379c43bc15ULL,
+        0x7c9853195eca9d5dULL, 0x48d21be392f4ae95ULL, 0xb4d00b9f3c44e197ULL, 0xb7c9ed8d5fbe8e5eULL,
+        0xa84f0c7caab0292dULL, 0x736734e24696355fULL, 0xed74dbc56be95866ULL, 0x698c81386f1c158aULL,
+        0x3cc93637ba4f6593ULL, 0x9cd55a8b0723673cULL, 0x4d8cf49c9f58614fULL, 0x8b95a795feb13353ULL,
+        0xbcadd7a3c93eda88ULL, 0xd08ae5b4e7f6bd7eULL, 0xdb47c9ed7c02d7acULL, 0x8bd8179dcbd8a51fULL,
+        0x0c230f805f3a682bULL, 0xa464fe3bc4202337ULL, 0xa1e7912c0108c755ULL, 0x91d31f649ef5302fULL,
+        0xc9c4a5d6cd582034ULL, 0x02a1149a2db312aeULL, 0x27d8460989a7d327ULL, 0x26e13cb92ee5bd60ULL,
+        0x74a233275a27aee7ULL, 0xe9c13ba25ecdb53eULL, 0x51b207056a71934bULL, 0x9a4222ced7acfdcaULL,
+        0xddfd1c7ed0039c0dULL, 0x2451de19626cc88cULL, 0x662e274b7ec27876ULL, 0x608f6d81ec49a72cULL,
+        0x760dc8a88b8a3881ULL, 0xee76b3944a50e105ULL, 0xdeb2b26652903dc0ULL, 0x5b22df4fca3bb6baULL,
+        0x7c15bd06cc1483acULL, 0x759a3041e453462dULL, 0x7dfeb15743d5b43cULL, 0x7bb524bb1eb84492ULL,
+        0xff5a1c5429c22234ULL, 0x79fe156181b4389cULL, 0xc354e00876755c16ULL, 0xbe75ff70015fa02aULL,
+        0xc67f6a6c4e9bbe13ULL, 0xe05d2f418da4e285ULL, 0xaa53b762d7889868ULL, 0x16afe2f8fee447e0ULL,
+        0xb5e4d5c1afe39711ULL, 0x8644ed6a483f141fULL, 0x1a89a3152965d1d0ULL, 0x180fbb8be9027c08ULL,
+        0x6d6881ba70b38d90ULL, 0x167b323b40986c55ULL, 0xa769f7075cf6b61fULL, 0x795458dea9bc8df4ULL,},
+    // bg Firepit
+    {
+        0x11fcc6b95afb3723ULL, 0xf68b19bf85a4bd24ULL, 0xe320d8356806c81bULL, 0x00adaa9ac24295c0ULL,
+        0x7d7466a3c2f50c54ULL, 0x139d49c3287076a0ULL, 0x567dad4f6df6a9a5ULL, 0xb86d2456073e4176ULL,
+        0x6af62b721bb661bfULL, 0xbb431992e9a13afaULL, 0x2612730187cd1ccaULL, 0xac2e8f15a2a7509dULL,
+        0x0cabda19be28b5c1ULL, 0x01a78ba133174915ULL, 0x64794b414ede5f8aULL, 0x7488bc11f728a0efULL,
+        0xcb12c5cd54af35eaULL, 0x487a9036a6fe2473ULL, 0x0763820bb93cb7b6ULL, 0xfb638eaa452b0caeULL,
+        0xe2943dcfbf62c7b6ULL, 0xfa9ee672f73af9ccULL, 0x3bffb34b7c8a5eafULL, 0xe284321e607d39aeULL,
+        0xc2b7e979d6fdfb57ULL, 0xa1fd175c303dec77ULL, 0x740c73ef21b77298ULL, 0x465d8ae157c76ad6ULL,
+        0xc7b105db7e12ce6dULL, 0x9bb31ec260571322ULL, 0x1e269a68c335566aULL, 0x6fab5f74b4959d42ULL,
+        0x462c669e8f4367b8ULL, 0xd6ee0318ec9237e7ULL, 0x087bd4978661a6c1ULL, 0x747b79c71935ed5eULL,
+        0xb3a0c5f4ed66b790ULL, 0x476133fbcb205b8bULL, 0xb6b236180e0241b3ULL, 0x90265e5dfcb60fedULL,
+        0x6578b370c5a83a96ULL, 0xa5899d4d8ed466a1ULL, 0xb7a7faf68f96362dULL, 0xf52d9579511fe152ULL,
+        0x2f5cc02a812bcc00ULL, 0xcc6783b2eae88f84ULL, 0x4f8f8b97962bc354ULL, 0x6df396e7f6fc719bULL,
+        0xf06834420f457272ULL, 0xae5b0fbd0ae5a50aULL, 0xc9335100f205713cULL, 0x24adf183bbfeb39cULL,
+        0xb9e3d3ac30ee33b9ULL, 0xd6dd850e07832161ULL, 0x627fbcdb703bfca6ULL, 0xb1a64f717796fec6ULL,
+        0x6766b46c21ab225eULL, 0x5589a46de649aa20ULL, 0xff7abe0a7aeb2fa6ULL, 0x0a2fc8ee830afffbULL,
+        0xda7b3b8068acd6fbULL, 0xb12ce3883005a538ULL, 0x323641319e48a261ULL, 0x97301b58b15cb1b6ULL,},
+    // bg Clip
+    {
+        0x2b3bc1f314fabadbULL, 0x2b3bc1f314fabadbULL, 0x2b3bc1f314fabadbULL, 0x2b3bc1f314fabadbULL,
+        0x167ef53faf88f7b3ULL, 0x167ef53faf88f7b3ULL, 0x167ef53faf88f7b3ULL, 0x167ef53faf88f7b3ULL,
+        0xc8db6a1c1c91993bULL, 0xc8db6a1c1c91993bULL, 0xc8db6a1c1c91993bULL, 0xc8db6a1c1c91993bULL,
+        0x735687f0909247e4ULL, 0x735687f0909247e4ULL, 0x735687f0909247e4ULL, 0x735687f0909247e4ULL,
+        0x83c6998481ebfba0ULL, 0x83c6998481ebfba0ULL, 0x83c6998481ebfba0ULL, 0x83c6998481ebfba0ULL,
+        0x42084c3b893471a6ULL, 0x42084c3b893471a6ULL, 0x42084c3b893471a6ULL, 0x42084c3b893471a6ULL,
+        0xb1a792bb298c88b3ULL, 0xb1a792bb298c88b3ULL, 0xb1a792bb298c88b3ULL, 0xb1a792bb298c88b3ULL,
+        0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL,
+        0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL,
+        0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL,
+        0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL,
+        0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL,
+        0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL,
+        0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL,
+        0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL,
+        0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL, 0xf9eafdca3fcdd5c5ULL,},
+    // bg Program
+    {
+        0xa76c3aad44138425ULL, 0xb817c0c496ee384cULL, 0x70fbcd5a37da267aULL, 0x07b7b1918608510eULL,
+        0x33a70df79f92c46eULL, 0xc26b9bdf38db162fULL, 0x30ad244c05feac7eULL, 0x3fcdf710431091feULL,
+        0x7bda111a49d04511ULL, 0x4c2b3b959ba85f3cULL, 0xd2beddecc75c8789ULL, 0x3e6b5975038d04eaULL,
+        0x9a4807ddfe1f2052ULL, 0xdc289e778998855aULL, 0xd51eaa6f3aa8d094ULL, 0xba5af655e189ec25ULL,
+        0xdf842dadca3dc19dULL, 0x3b94eceb7e05202dULL, 0x1ac2d69c783af542ULL, 0xf32b5a547d64049eULL,
+        0xdde2e745e08b49b1ULL, 0xa9fb207315a262b4ULL, 0x326df161b4f40822ULL, 0x31d44d828a18a770ULL,
+        0x40174855fb6ef4aeULL, 0xc4ca2a66b3229781ULL, 0x37df6f1958e541e9ULL, 0x37dddf9ef3ffc6ccULL,
+        0xfd32ad4ac3fb1830ULL, 0x16956e5e06a25097ULL, 0xd0c950cbeef4b33bULL, 0x05e2800eccc67ea4ULL,
+        0x3eb227d1e565d5f9ULL, 0x1a915b5e41197e62ULL, 0x1ea789d5cc784bccULL, 0x85d084c44d7fd56eULL,
+        0x820e1cd9036a59afULL, 0xd03d3819d00f7490ULL, 0xc96733eb961cfb0aULL, 0xe06000ea86e24af0ULL,
+        0x0e539d257da72c0aULL, 0xf2e4041ab9014f74ULL, 0x7f687e5330ad6648ULL, 0x8dbd94d77d42c3e0ULL,
+        0xdb064b988669765cULL, 0x96e04329dfa54cc2ULL, 0xccc92545047a7ef1ULL, 0xdb794b5d5da818f5ULL,
+        0xefd9e7cce1788bf4ULL, 0x28553b5c93cef5e1ULL, 0xc49f388cba42715bULL, 0x7e914849a8c9ed16ULL,
+        0xc75b2df75075934eULL, 0x26c496167f377a64ULL, 0x3132207aed82b315ULL, 0x59d6fa9fce4f50b8ULL,
+        0x16fb56400dcbb5dbULL, 0xd650411dd4af87c8ULL, 0x984aef3b9722829dULL, 0x3b520e9be75102deULL,
+        0xe54917cb0ac7f423ULL, 0x5c0a7f48468ad169ULL, 0x89978daf8d654f29ULL, 0x710a0cbf9ba6b7ceULL,},
+    // fr SolidColor
+    {
+        0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL,
+        0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL,
+        0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL,
+        0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL,
+        0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL,
+        0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL,
+        0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL,
+        0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL,
+        0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL,
+        0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL,
+        0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL,
+        0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL,
+        0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL,
+        0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL,
+        0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL,
+        0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL, 0x35a31fa0cc984c4fULL,},
+    // fr Time
+    {
+        0xc8e655debe5cfa98ULL, 0xc8e655debe5cfa98ULL, 0xc8e655debe5cfa98ULL, 0xc8e655debe5cfa98ULL,
+        0xc8e655debe5cfa98ULL, 0xc8e655debe5cfa98ULL, 0xc8e655debe5cfa98ULL, 0xc8e655debe5cfa98ULL,
+        0xc8e655debe5cfa98ULL, 0xc8e655debe5cfa98ULL, 0xc8e655debe5cfa98ULL, 0xc8e655debe5cfa98ULL,
+        0xc8e655debe5cfa98ULL, 0xc8e655debe5cfa98ULL, 0xc8e655debe5cfa98ULL, 0xc8e655debe5cfa98ULL,
+        0xc8e655debe5cfa98ULL, 0xc8e655debe5cfa98ULL, 0xc8e655debe5cfa98ULL, 0xfb7654c34a3e2ff5ULL,
+        0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL,
+        0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL,
+        0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL,
+        0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL,
+        0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL,
+        0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL,
+        0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL,
+        0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL,
+        0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL,
+        0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL, 0xfb7654c34a3e2ff5ULL, 0x3c56c80c49afe632ULL,
+        0x3c56c80c49afe632ULL, 0x3c56c80c49afe632ULL, 0x3c56c80c49afe632ULL, 0x3c56c80c49afe632ULL,},
+    // fg Time
+    {
+        0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL,
+        0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL,
+        0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL,
+        0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL,
+        0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x6f703a644a3c92b3ULL,
+        0x6f703a644a3c92b3ULL, 0x6f703a644a3c92b3ULL, 0x6f703a644a3c92b3ULL, 0x6f703a644a3c92b3ULL,
+        0x6f703a644a3c92b3ULL, 0x6f703a644a3c92b3ULL, 0x6f703a644a3c92b3ULL, 0x6f703a644a3c92b3ULL,
+        0x6f703a644a3c92b3ULL, 0x6f703a644a3c92b3ULL, 0x6f703a644a3c92b3ULL, 0x6f703a644a3c92b3ULL,
+        0x6f703a644a3c92b3ULL, 0x6f703a644a3c92b3ULL, 0x6f703a644a3c92b3ULL, 0x6f703a644a3c92b3ULL,
+        0x6f703a644a3c92b3ULL, 0x6f703a644a3c92b3ULL, 0x6f703a644a3c92b3ULL, 0x7861c4726f949761ULL,
+        0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL,
+        0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL,
+        0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL,
+        0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL,
+        0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x6f703a644a3c92b3ULL,
+        0x6f703a644a3c92b3ULL, 0x6f703a644a3c92b3ULL, 0x6f703a644a3c92b3ULL, 0x6f703a644a3c92b3ULL,},
+    // fg TimeRainbow
+    {
+        0x38fd165f5e74500eULL, 0x38fd165f5e74500eULL, 0x38fd165f5e74500eULL, 0x38fd165f5e74500eULL,
+        0x38fd165f5e74500eULL, 0xb93c08852a3f72a6ULL, 0xb93c08852a3f72a6ULL, 0xb93c08852a3f72a6ULL,
+        0xb93c08852a3f72a6ULL, 0xb93c08852a3f72a6ULL, 0xb93c08852a3f72a6ULL, 0x1bd523a85a914aafULL,
+        0x1bd523a85a914aafULL, 0x1bd523a85a914aafULL, 0x1bd523a85a914aafULL, 0x1bd523a85a914aafULL,
+        0x1bd523a85a914aafULL, 0x4ec766e459c02bb8ULL, 0x4ec766e459c02bb8ULL, 0x8400671afff479f1ULL,
+        0x8400671afff479f1ULL, 0x8400671afff479f1ULL, 0x8400671afff479f1ULL, 0x71938d92fdccadc5ULL,
+        0x71938d92fdccadc5ULL, 0x71938d92fdccadc5ULL, 0x71938d92fdccadc5ULL, 0x71938d92fdccadc5ULL,
+        0x71938d92fdccadc5ULL, 0x0e6f78664901a2d8ULL, 0x0e6f78664901a2d8ULL, 0x0e6f78664901a2d8ULL,
+        0x0e6f78664901a2d8ULL, 0x0e6f78664901a2d8ULL, 0x0e6f78664901a2d8ULL, 0xab8385054a9e9f6cULL,
+        0xab8385054a9e9f6cULL, 0xab8385054a9e9f6cULL, 0xab8385054a9e9f6cULL, 0xac664df5b2bd3438ULL,
+        0xac664df5b2bd3438ULL, 0x5954ad7ef827135aULL, 0x5954ad7ef827135aULL, 0x5954ad7ef827135aULL,
+        0x5954ad7ef827135aULL, 0x5954ad7ef827135aULL, 0x5954ad7ef827135aULL, 0x24055854d80008cdULL,
+        0x24055854d80008cdULL, 0x24055854d80008cdULL, 0x24055854d80008cdULL, 0x24055854d80008cdULL,
+        0x24055854d80008cdULL, 0xbf9370b8522297d5ULL, 0xbf9370b8522297d5ULL, 0xbf9370b8522297d5ULL,
+        0xbf9370b8522297d5ULL, 0xbf9370b8522297d5ULL, 0xbf9370b8522297d5ULL, 0x8c9664a5f7dca7fdULL,
+        0x8c9664a5f7dca7fdULL, 0x8c9664a5f7dca7fdULL, 0x8c9664a5f7dca7fdULL, 0x8c9664a5f7dca7fdULL,},
+    // fg Cycle
+    {
+        0xbc6c1dedec053e64ULL, 0x0c5dcf7dc175fe30ULL, 0x8168a2849de26128ULL, 0x9881cc94906291e9ULL,
+        0x839a98691a3b5887ULL, 0xbfee7123090064b9ULL, 0xb99300525c4ad6f9ULL, 0x3dd2e8d1b4a69544ULL,
+        0x3e09e2e9dd15946aULL, 0xd215bd77aa027faaULL, 0xd18b11b23e7c6db4ULL, 0xdbb94848c10aab80ULL,
+        0x733f965a7718a1b8ULL, 0x60d034cd04e6b2f9ULL, 0x0fe51c97dbbf5e97ULL, 0x07579560b02b9809ULL,
+        0x7034d0bd7ae14549ULL, 0xf5d4b26c2c886a94ULL, 0xb1dab645e2912abaULL, 0xc8085ef2a2679dfaULL,
+        0x1855e06750031c80ULL, 0x83eca95364005394ULL, 0x0707db6d04e171acULL, 0x2d6d3dcb2b7b7845ULL,
+        0xac7e64e5ff239a2bULL, 0xbde5509bc40bcfd5ULL, 0xe02d7ccca8f9ad15ULL, 0x24b7997cfbabf960ULL,
+        0x8311de3fc64a7d4eULL, 0xd3194851c125428eULL, 0xedbfd8ab4527b058ULL, 0xe725e885feb9ba1cULL,
+        0x271f7a7ca7f2d1d4ULL, 0x50a63e39f92db21dULL, 0xb5f97c75e7ed70b3ULL, 0x1d32a47e06a574edULL,
+        0xb7806317393fffadULL, 0xf79f5fb937fff058ULL, 0x42f35e31bd0cb576ULL, 0x299abb8effe60a36ULL,
+        0xc441335776e50444ULL, 0x93eae3d640cc7fb0ULL, 0xc7dc9d49c4d6e6c8ULL, 0x8793285da64e70c9ULL,
+        0x9b4ddf00ff101b07ULL, 0x0b7ff97577392459ULL, 0xd1cf0d2b3f8bcb99ULL, 0xc55ffd2a33fd16c4ULL,
+        0x242d6fb7f469308aULL, 0xd02df2450bdf2bcaULL, 0x601affc06abce714ULL, 0xefad5adb1b9e0780ULL,
+        0x6ea9af5cb4067358ULL, 0x568e2d1fd7e96b59ULL, 0x23d92f2a3652ba97ULL, 0xbf4f7e6928fa4729ULL,
+        0x46dc58ec4a0ebe69ULL, 0x09c8c4fe871bc694ULL, 0x645397585850795aULL, 0x4d2c1b2b2c1ce59aULL,
+        0x57b5835faca405ecULL, 0x5684e03397e68d88ULL, 0x88a41276a3cdbb20ULL, 0x63d8c5888a7164f1ULL,},
+    // fg Text
+    {
+        0x55fdcdeee4c49583ULL, 0x55fdcdeee4c49583ULL, 0xca3a729debe57fbfULL, 0x749615a4a872487fULL,
+        0x809705fa28662586ULL, 0xc1eafc1fc60e104cULL, 0xcdff5635e56a4c42ULL, 0x32defd9bd487ad11ULL,
+        0x743127cb13ade328ULL, 0xd0814a75a16297e4ULL, 0xfc7e6a8a356fe507ULL, 0xc2712df522bf0a72ULL,
+        0xb7601ce9a746402fULL, 0xa00762c46f01b268ULL, 0x477de3b896b2d624ULL, 0x1de7c01d33f567f3ULL,
+        0x81d8b8db696d791dULL, 0xf21c2e929e8f21e1ULL, 0xeb52e48493c59366ULL, 0x1a36b81b5bc54a68ULL,
+        0x547b9e62b4d53eaaULL, 0x81509f78b1c3ccedULL, 0x0237e93e7ab3e1acULL, 0xf5d6bd27ece96befULL,
+        0xbdedb990695c0ed8ULL, 0x720316413e1b6708ULL, 0x8e6d2014b2cb5230ULL, 0x1957503fde635c45ULL,
+        0x2019a993e3abcf27ULL, 0x21b29f667f15dfbbULL, 0x7e77ef70f5c96b80ULL, 0x287ac0fe91143c14ULL,
+        0xcf1cfdb1cf549d0aULL, 0xb12993d6dec0674bULL, 0x4b1e898a4343d049ULL, 0xe38754b5a01bf423ULL,
+        0x46b67c2bba17e322ULL, 0x639f3fee759544beULL, 0xc200515d76e2d61eULL, 0x77f4a07af0c5109eULL,
+        0xe8ce884b93fac21aULL, 0x410df10d6388fa57ULL, 0x3abe68f502614c5fULL, 0x9ebe7dc567043e2cULL,
+        0xa53017c030be7fb3ULL, 0xcf31552a08683db6ULL, 0xf698b77797af9100ULL, 0xe3e2cfaf1f5087c6ULL,
+        0x062546fa5a4896aeULL, 0x230dde6c28c33544ULL, 0xcb252308b48e825aULL, 0x1632ce1a51f6a915ULL,
+        0x4fd994c89b65d0bfULL, 0xd2179ddd905b92edULL, 0x95dadc45ba1227ffULL, 0x2f04bd7b939cc396ULL,
+        0x12132e7c273f1af6ULL, 0x1752eff872106937ULL, 0x6275a958963a51faULL, 0x986742bb4afb105dULL,
+        0x7ab092b5069e5f71ULL, 0xe9737448015cfb9eULL, 0xa541b2294f9f999fULL, 0x897a66c48ca02b06ULL,},
+    // fg Gradient
+    {
+        0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL,
+        0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL,
+        0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL,
+        0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL,
+        0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL, 0x33792d7c92e675a5ULL,
+        0x33792d7c92e675a5ULL, 0x33792d7c92e675a5ULL, 0x33792d7c92e675a5ULL, 0x33792d7c92e675a5ULL,
+        0x33792d7c92e675a5ULL, 0x33792d7c92e675a5ULL, 0x33792d7c92e675a5ULL, 0x33792d7c92e675a5ULL,
+        0x33792d7c92e675a5ULL, 0x33792d7c92e675a5ULL, 0x33792d7c92e675a5ULL, 0x33792d7c92e675a5ULL,
+        0x33792d7c92e675a5ULL, 0x33792d7c92e675a5ULL, 0x33792d7c92e675a5ULL, 0x33792d7c92e675a5ULL,
+        0x33792d7c92e675a5ULL, 0x33792d7c92e675a5ULL, 0x33792d7c92e675a5ULL, 0xe8efb699246c94c7ULL,
+        0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL,
+        0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL,
+        0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL,
+        0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL,
+        0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL, 0xe8efb699246c94c7ULL, 0x33792d7c92e675a5ULL,
+        0x33792d7c92e675a5ULL, 0x33792d7c92e675a5ULL, 0x33792d7c92e675a5ULL, 0x33792d7c92e675a5ULL,},
+    // fg Digits
+    {
+        0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL,
+        0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL,
+        0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL,
+        0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL,
+        0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL, 0x3904795f5294bd72ULL,
+        0x3904795f5294bd72ULL, 0x3904795f5294bd72ULL, 0x3904795f5294bd72ULL, 0x3904795f5294bd72ULL,
+        0x3904795f5294bd72ULL, 0x3904795f5294bd72ULL, 0x3904795f5294bd72ULL, 0x3904795f5294bd72ULL,
+        0x3904795f5294bd72ULL, 0x3904795f5294bd72ULL, 0x3904795f5294bd72ULL, 0x3904795f5294bd72ULL,
+        0x3904795f5294bd72ULL, 0x3904795f5294bd72ULL, 0x3904795f5294bd72ULL, 0x3904795f5294bd72ULL,
+        0x3904795f5294bd72ULL, 0x3904795f5294bd72ULL, 0x3904795f5294bd72ULL, 0x1af37cd02e028798ULL,
+        0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL,
+        0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL,
+        0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL,
+        0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL,
+        0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL, 0x1af37cd02e028798ULL, 0x3904795f5294bd72ULL,
+        0x3904795f5294bd72ULL, 0x3904795f5294bd72ULL, 0x3904795f5294bd72ULL, 0x3904795f5294bd72ULL,},
+    // fg Morph
+    {
+        0x577e7c49a75f16bfULL, 0x577e7c49a75f16bfULL, 0x577e7c49a75f16bfULL, 0x577e7c49a75f16bfULL,
+        0x577e7c49a75f16bfULL, 0xf6d7a762887e2be5ULL, 0xf6d7a762887e2be5ULL, 0xf6d7a762887e2be5ULL,
+        0xf6d7a762887e2be5ULL, 0xf6d7a762887e2be5ULL, 0xf6d7a762887e2be5ULL, 0x9a070ce1f070f4adULL,
+        0x9a070ce1f070f4adULL, 0x9a070ce1f070f4adULL, 0x9a070ce1f070f4adULL, 0x9a070ce1f070f4adULL,
+        0x9a070ce1f070f4adULL, 0xaf8e5a391887c744ULL, 0xaf8e5a391887c744ULL, 0x5f0d942d031d25d3ULL,
+        0x5f0d942d031d25d3ULL, 0x5f0d942d031d25d3ULL, 0x5f0d942d031d25d3ULL, 0xfd8b810979dbb71eULL,
+        0xfd8b810979dbb71eULL, 0xfd8b810979dbb71eULL, 0xfd8b810979dbb71eULL, 0xfd8b810979dbb71eULL,
+        0xfd8b810979dbb71eULL, 0x6b31dfc0e621b253ULL, 0x6b31dfc0e621b253ULL, 0x6b31dfc0e621b253ULL,
+        0x6b31dfc0e621b253ULL, 0x6b31dfc0e621b253ULL, 0x6b31dfc0e621b253ULL, 0xa7aa12dcaee9b7b6ULL,
+        0xa7aa12dcaee9b7b6ULL, 0xa7aa12dcaee9b7b6ULL, 0xa7aa12dcaee9b7b6ULL, 0x684638adf86c3f04ULL,
+        0xdb9d9de6f797d505ULL, 0xb5a28b1b1dcb3f31ULL, 0x72a33eabc4233d4fULL, 0x65070997bdd8e402ULL,
+        0xfb8eac9dcf97fd32ULL, 0xa4a65026e96c74adULL, 0xa8f6323c69de2cfcULL, 0xf575aeac00786b69ULL,
+        0xf575aeac00786b69ULL, 0xf575aeac00786b69ULL, 0xf575aeac00786b69ULL, 0xf575aeac00786b69ULL,
+        0xf575aeac00786b69ULL, 0xb152be16a9567eafULL, 0xb152be16a9567eafULL, 0xb152be16a9567eafULL,
+        0xb152be16a9567eafULL, 0xb152be16a9567eafULL, 0xb152be16a9567eafULL, 0x32aeca5cf7a468e9ULL,
+        0x32aeca5cf7a468e9ULL, 0x32aeca5cf7a468e9ULL, 0x32aeca5cf7a468e9ULL, 0x32aeca5cf7a468e9ULL,},
+    // fg Label
+    {
+        0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL,
+        0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL,
+        0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL,
+        0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL,
+        0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL,
+        0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL,
+        0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL,
+        0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL,
+        0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL,
+        0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL,
+        0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL,
+        0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL,
+        0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL,
+        0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL,
+        0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL,
+        0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL, 0x75267df4b3c0e1a1ULL,},
+    // fg Slide
+    {
+        0x14e423fa27a05f45ULL, 0xe5e253d3aba24639ULL, 0x70450c4894c6652bULL, 0x293d9ebcc9d91aa1ULL,
+        0x671d2dcc09fab6f5ULL, 0xdd09b54d83d2f9ebULL, 0xa4cb479b6d32b8b2ULL, 0x77cb139b7c620bceULL,
+        0xe53d1205a551159cULL, 0x3feebdb7638e7613ULL, 0xaa81eb0725c86ab6ULL, 0xc2cc355a2adcf1f4ULL,
+        0xa6afe6617834398bULL, 0xef5bd679ec6d75efULL, 0x1f761e27e1082ba9ULL, 0x0fc6236c86fa7e00ULL,
+        0xe42eaa6bd0f7180dULL, 0x06a8d84263d2f878ULL, 0x4762179f86826b13ULL, 0xef8a3b13840b0c6dULL,
+        0x9efe37c582424330ULL, 0xbd2d77b1ec12547dULL, 0xd8d5cbd8939b9147ULL, 0x46e9d88d393ad487ULL,
+        0xb00a23d004a0824bULL, 0x434c138aed9a4561ULL, 0xc331db12924cb4ccULL, 0x79b4b150aea45d67ULL,
+        0x8f3d45996753707bULL, 0xd9f9c9780307dd92ULL, 0xc9d644fa2ef43485ULL, 0x5377ca20a03985adULL,
+        0xfb6fd78a2681859aULL, 0x2523918a904d94d6ULL, 0x250f386e26c728cfULL, 0x043c322d00080d2dULL,
+        0x286a348128f04ebeULL, 0x8434d342919c9f01ULL, 0xc7bddb75d980976eULL, 0xe1c3d0f8449c5e47ULL,
+        0x6c4981b8782a70d8ULL, 0x35ab625af13c6a6dULL, 0x6efe6b2384990777ULL, 0x760b7265a71b1541ULL,
+        0x1723c9cce4d6fcebULL, 0x6b92527d6ba0ec1fULL, 0x431abb5e70de1791ULL, 0x4dd0ae44ec39de28ULL,
+        0x969c3e48ed362978ULL, 0xe68b4516e39ec745ULL, 0xa4f30cb53b97701bULL, 0x634b501409212671ULL,
+        0x539c1223590d0cdaULL, 0xee2854557057ab6eULL, 0x911779f140193cf7ULL, 0x122c95f0778cb2d5ULL,
+        0x16ceb7b61f4fd4a3ULL, 0x4f037bc1b17db20eULL, 0x12720596ff27cfafULL, 0xed38fc7879081c24ULL,
+        0x1a924d333a259057ULL, 0x3461903e2276e782ULL, 0xa26d4462679cb432ULL, 0x0dc44d5f0a9c59d7ULL,},
+    // mixed
+    {
+        0x52feaef3c113201cULL, 0x6e9ca8de46413184ULL, 0xbd258cd6e61e4f64ULL, 0xd8d359c95b38bb28ULL,
+        0xfdec9961e2a64191ULL, 0x24802f3b3d937781ULL, 0x7e88fb6db700213dULL, 0x194c8f22fb1ad644ULL,
+        0x9f6f134bb18a6ba8ULL, 0x63400e9b531fdee7ULL, 0x31dcdc5cec2f692dULL, 0x75af2461a6016a4aULL,
+        0x9728643682cf1418ULL, 0x43197bb80182555cULL, 0x4f6c034dc4fb57ffULL, 0xb9e39a2a029d0952ULL,
+        0x4f735595008061c3ULL, 0xb009c958c1d95d86ULL, 0x26d3b84b4905c83fULL, 0x4718c97b6f2dfedbULL,
+        0xa006a0eaf4854ff8ULL, 0x6edc872534c279e9ULL, 0xd408862ac3bea408ULL, 0xd5cce9417b334fa8ULL,
+        0x667b9bd26526de22ULL, 0xa7cefe83b2dceae6ULL, 0x4e7f1f19694b2eb4ULL, 0x4e8802fc9b6e90c9ULL,
+        0xa60599b72bc63505ULL, 0xaa2db465cf22d547ULL, 0xd2a5b8b450f4916aULL, 0xd13442f0809c49a9ULL,
+        0x6585ca2c847b3031ULL, 0x4bd7ca0838846f7dULL, 0x19d4af6f3d7c8e64ULL, 0x98f3d63d0596308aULL,
+        0xd31bc012f1786298ULL, 0x721c551a0d323db5ULL, 0x7bdf657785b4e8daULL, 0xa1483124bb00b007ULL,
+        0x9c51438efcc2036cULL, 0x06b1e3a5d140da5aULL, 0xa8a1f3be40eb1dfaULL, 0x37d10fa050e130caULL,
+        0x31621913c856ddd4ULL, 0xd3494afd0895fa66ULL, 0x554021f779020459ULL, 0x3d7057059a87d2f2ULL,
+        0x105665d92312d7ebULL, 0xf06e13f526a18d18ULL, 0x5a48e752b58b5659ULL, 0xc2ade107879eb2b3ULL,
+        0x3a3c2183a184c5adULL, 0xe9bb059fac3a0570ULL, 0x9f12d1c73728688dULL, 0xd1a54e0db070b1c2ULL,
+        0xf084e9a41d571827ULL, 0x88c066fa6312070fULL, 0x3b041415cfa14d46ULL, 0x0676fb2c8f16611eULL,
+        0xba9604fabad3f165ULL, 0x4c60e7649594850aULL, 0x477219e6ae8ac1e3ULL, 0xf96d692f4c01d72eULL,},
+    // crossfade
+    {
+        0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL,
+        0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL,
+        0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL,
+        0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL,
+        0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x7861c4726f949761ULL, 0x6f703a644a3c92b3ULL,
+        0x6f703a644a3c92b3ULL, 0xb954eabee962f733ULL, 0x67fac07a0edf06aaULL, 0x1a1e44d29c4c1d7dULL,
+        0x0d9385a1f5301a9fULL, 0x8231eaf394ca42ecULL, 0x5a60bea69f7ba012ULL, 0x7991c1dcae8a5842ULL,
+        0x3a35d10c415391bfULL, 0xee665e55a3e731afULL, 0xdcfa652ca5d94d5cULL, 0x3439a2a363ace51cULL,
+        0x680cd4a3e836b6c9ULL, 0xc8c2f19b16f33b9aULL, 0x7145c82b2a3587c0ULL, 0xfcc96547822be64fULL,
+        0x139c322180a3ad9bULL, 0xcf660e1e4615fa6fULL, 0x576aceb8930e2770ULL, 0x0d242a65d0b82245ULL,
+        0xa66453b7b81da1f0ULL, 0x25a50e54af30b651ULL, 0x6f8da407eb62a24cULL, 0x1746a3226178b4d1ULL,
+        0xb367004309b9bcb3ULL, 0xc2f1546eeb48752bULL, 0xe548e1149f34c11dULL, 0x495811eb5259a82cULL,
+        0xc38995ac0698fb58ULL, 0x07c87a1bc6bf185eULL, 0xa8bac1313263579fULL, 0x768b4be7de67ca48ULL,
+        0xb1dab3af321b77c8ULL, 0x4dc009b4fbd7712cULL, 0x4f2fbb0cda842221ULL, 0x9ef43349ae8d306bULL,
+        0x38542e39cd623345ULL, 0x4dd51939d5f09ec4ULL, 0xe797551c3d6fe59fULL, 0x39e64ca5149aed2dULL,
+        0xf34d469ed8ac025eULL, 0x3d44412af8a8be20ULL, 0x759fe4012fec8394ULL, 0xa3457698ef72baccULL,},
+};
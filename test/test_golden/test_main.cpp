@@ -0,0 +1,213 @@
+/**
+ * @file test_main.cpp
+ * @brief Golden frame tests of PLedDisp on the host
+ *
+ * Renders the first FRAMES frames of every mode with a fixed random seed and a simulated clock
+ * and compares every frame sent to the strip byte for byte, by its 64 bit FNV-1a hash, with the
+ * frames recorded in golden_frames.h. Effects can be reworked freely as long as these pass.
+ *
+ * Run with: pio test -e native_test
+ * After an intended change of the output record new golden frames with
+ * pio test -e native_test -a <path to test/test_golden/golden_frames.h>
+ *
+ * @date 2026-10-15
+ */
+
+#include <FastLED.h>
+#include <RTClib.h>
+#include <unity.h>
+
+#include <cstdio>
+
+#include "PLedDisp/PLedDisp.h"
+
+// Global Time keeping, normally provided by main.cpp
+RTC_Millis RTC_TIME;
+DateTime TIME_NOW;
+
+const int FRAMES = 64;            // Frames per case
+const int FRAME_PERIOD_MS = 50;   // One animation step per frame
+const uint32_t SEED = 1;          // Seed of the effects
+const char *TEXT = "Paper 21`C";  // Text of ModeFG::Text
+const char *LABEL = "-4.5`C";     // Label of ModeFG::Label
+const int EVENT_FRAME = 20;       // Frame where the mixed case raises its warnings and the fade cases switch
+
+struct GoldenCase {
+    const char *name;
+    PLedDisp::ModeBG bg;
+    PLedDisp::ModeFR fr;
+    PLedDisp::ModeFG fg;
+    bool warnings;    // Raise a warning and an error during the case
+    uint16_t fadeMs;  // Start with the default modes and crossfade to the ones of the case at EVENT_FRAME
+    PLedDisp::ShadeFG shade;
+    bool minuteChange;  // Start two seconds before the hour changes, the digits morph
+    int16_t slideStep;  // The label slides in from the right by 1/256 columns per frame
+};
+
+static const CRGB SECOND_COLOR = CRGB::Blue;  // Bottom colour of ShadeFG::Gradient
+static const CRGB DIGIT_COLORS[PLedShade::DIGIT_COUNT] = {CRGB::Red, CRGB::Green, CRGB::Blue, CRGB::White};
+
+static const GoldenCase CASES[] = {
+    {"bg None", PLedDisp::ModeBG::None, PLedDisp::ModeFR::None, PLedDisp::ModeFG::None, false},
+    {"bg SolidColor", PLedDisp::ModeBG::SolidColor, PLedDisp::ModeFR::None, PLedDisp::ModeFG::None, false},
+    {"bg ScrollingRainbow", PLedDisp::ModeBG::ScrollingRainbow, PLedDisp::ModeFR::None, PLedDisp::ModeFG::None, false},
+    {"bg Twinkle", PLedDisp::ModeBG::Twinkle, PLedDisp::ModeFR::None, PLedDisp::ModeFG::None, false},
+    {"bg Fireworks", PLedDisp::ModeBG::Fireworks, PLedDisp::ModeFR::None, PLedDisp::ModeFG::None, false},
+    {"bg Thunderstorm", PLedDisp::ModeBG::Thunderstorm, PLedDisp::ModeFR::None, PLedDisp::ModeFG::None, false},
+    {"bg Firepit", PLedDisp::ModeBG::Firepit, PLedDisp::ModeFR::None, PLedDisp::ModeFG::None, false},
+    {"bg Clip", PLedDisp::ModeBG::Clip, PLedDisp::ModeFR::None, PLedDisp::ModeFG::None, false},
+    {"bg Program", PLedDisp::ModeBG::Program, PLedDisp::ModeFR::None, PLedDisp::ModeFG::None, false},
+    {"fr SolidColor", PLedDisp::ModeBG::None, PLedDisp::ModeFR::SolidColor, PLedDisp::ModeFG::None, false},
+    {"fr Time", PLedDisp::ModeBG::None, PLedDisp::ModeFR::Time, PLedDisp::ModeFG::None, false},
+    {"fg Time", PLedDisp::ModeBG::None, PLedDisp::ModeFR::None, PLedDisp::ModeFG::Time, false},
+    {"fg TimeRainbow", PLedDisp::ModeBG::None, PLedDisp::ModeFR::None, PLedDisp::ModeFG::TimeRainbow, false},
+    {"fg Cycle", PLedDisp::ModeBG::None, PLedDisp::ModeFR::None, PLedDisp::ModeFG::Cycle, false},
+    {"fg Text", PLedDisp::ModeBG::None, PLedDisp::ModeFR::None, PLedDisp::ModeFG::Text, false},
+    {"fg Gradient", PLedDisp::ModeBG::None, PLedDisp::ModeFR::None, PLedDisp::ModeFG::Time, false, 0, PLedDisp::ShadeFG::Gradient},
+    {"fg Digits", PLedDisp::ModeBG::None, PLedDisp::ModeFR::None, PLedDisp::ModeFG::Time, false, 0, PLedDisp::ShadeFG::Digits},
+    {"fg Morph", PLedDisp::ModeBG::ScrollingRainbow, PLedDisp::ModeFR::None, PLedDisp::ModeFG::Time, false, 0, PLedDisp::ShadeFG::Solid, true},
+    {"fg Label", PLedDisp::ModeBG::None, PLedDisp::ModeFR::None, PLedDisp::ModeFG::Label, false, 0, PLedDisp::ShadeFG::Digits},
+    {"fg Slide", PLedDisp::ModeBG::ScrollingRainbow, PLedDisp::ModeFR::None, PLedDisp::ModeFG::Label, false, 0, PLedDisp::ShadeFG::Solid, false, 40},
+    {"mixed", PLedDisp::ModeBG::Firepit, PLedDisp::ModeFR::Time, PLedDisp::ModeFG::TimeRainbow, true},
+    {"crossfade", PLedDisp::ModeBG::Firepit, PLedDisp::ModeFR::Time, PLedDisp::ModeFG::TimeRainbow, false, 1000},
+};
+const int CASE_COUNT = sizeof(CASES) / sizeof(CASES[0]);
+
+#include "golden_frames.h"
+static_assert(sizeof(GOLDEN_FRAMES) == sizeof(uint64_t) * CASE_COUNT * FRAMES, "Record golden_frames.h again");
+
+static const char *recordPath = nullptr;  // Write the golden frames instead of checking them
+static uint64_t frames[CASE_COUNT][FRAMES];
+
+/**
+ * @brief FNV-1a hash of the frame on the strip
+ */
+static uint64_t hashStrip() {
+    const uint8_t *p = (const uint8_t *)FastLED.leds();
+    uint64_t h = 1469598103934665603ULL;
+    for (int i = 0; i < NUM_LEDS * 3; i++) {
+        h = (h ^ p[i]) * 1099511628211ULL;
+    }
+    return h;
+}
+
+/**
+ * @brief Render the frames of a case from a fixed start
+ */
+static void render(const GoldenCase &c, uint64_t *out) {
+    sim::setMillis(0);
+    RTC_TIME.begin(c.minuteChange ? DateTime(2022, 1, 23, 12, 59, 58) : DateTime(2022, 1, 23, 12, 34, 50));
+    TIME_NOW = RTC_TIME.now();
+
+    PLedDisp *disp = new PLedDisp();
+    disp->seedRandom(SEED);
+    disp->setText(TEXT);
+    disp->setLabel(LABEL);
+    for (uint8_t digit = 0; digit < PLedShade::DIGIT_COUNT; digit++) {
+        disp->setDigitColor(digit, DIGIT_COLORS[digit]);
+    }
+    disp->setForegroundShade(c.shade, SECOND_COLOR);
+    if (c.fadeMs == 0) {
+        disp->setBackgroundMode(c.bg);
+        disp->setFrameMode(c.fr);
+        disp->setForegroundMode(c.fg, true);
+    }
+    for (int i = 0; i < FRAMES; i++) {
+        if (c.warnings && (i == EVENT_FRAME)) {
+            disp->setWarning(1, false, 1);
+            disp->setWarning(3, false, 2);
+        }
+        if (c.slideStep != 0) {
+            disp->setLabelOffset((FRAMES - 1 - i) * c.slideStep);
+        }
+        if ((c.fadeMs != 0) && (i == EVENT_FRAME)) {
+            disp->setBackgroundMode(c.bg, c.fadeMs);
+            disp->setFrameMode(c.fr, c.fadeMs);
+            disp->setForegroundMode(c.fg, true, c.fadeMs);
+        }
+        sim::advanceMillis(FRAME_PERIOD_MS);
+        TIME_NOW = RTC_TIME.now();
+        disp->update_LEDs();
+        out[i] = hashStrip();
+    }
+    delete disp;
+}
+
+static void checkCases(int first, int last) {
+    char message[80];
+    for (int c = first; c <= last; c++) {
+        render(CASES[c], frames[c]);
+        if (recordPath != nullptr) {
+            continue;
+        }
+        for (int i = 0; i < FRAMES; i++) {
+            if (frames[c][i] != GOLDEN_FRAMES[c][i]) {
+                snprintf(message, sizeof(message), "%s: frame %d differs from the golden frame", CASES[c].name, i);
+                TEST_FAIL_MESSAGE(message);
+            }
+        }
+    }
+}
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+void test_backgrounds() {
+    checkCases(0, 8);
+}
+
+void test_frames() {
+    checkCases(9, 10);
+}
+
+void test_foregrounds() {
+    checkCases(11, 19);
+}
+
+void test_mixed() {
+    checkCases(20, 20);
+}
+
+void test_crossfade() {
+    checkCases(21, 21);
+}
+
+/**
+ * @brief Write golden_frames.h with the frames rendered by the tests
+ */
+static void test_record() {
+    FILE *f = fopen(recordPath, "w");
+    TEST_ASSERT_NOT_NULL_MESSAGE(f, "Cannot write the golden frames");
+    fprintf(f, "// Golden frames of test_golden, FNV-1a hash per frame. Generated, do not edit.\n");
+    fprintf(f, "#pragma once\n\n");
+    fprintf(f, "static const uint64_t GOLDEN_FRAMES[%d][%d] = {\n", CASE_COUNT, FRAMES);
+    for (int c = 0; c < CASE_COUNT; c++) {
+        fprintf(f, "    // %s\n    {", CASES[c].name);
+        for (int i = 0; i < FRAMES; i++) {
+            fprintf(f, "%s0x%016llxULL,", (i % 4 == 0) ? "\n        " : " ", (unsigned long long)frames[c][i]);
+        }
+        fprintf(f, "},\n");
+    }
+    fprintf(f, "};\n");
+    fclose(f);
+    TEST_IGNORE_MESSAGE("Golden frames recorded");
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1) {
+        recordPath = argv[1];
+    }
+    UNITY_BEGIN();
+    RUN_TEST(test_backgrounds);
+    RUN_TEST(test_frames);
+    RUN_TEST(test_foregrounds);
+    RUN_TEST(test_mixed);
+    RUN_TEST(test_crossfade);
+    if (recordPath != nullptr) {
+        RUN_TEST(test_record);
+    }
+    return UNITY_END();
+}
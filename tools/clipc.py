@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+"""Converter of text animation clips to the binary clip format of PLedClip.
+
+Usage:
+    clipc.py <clip.txt> -o <clip.plc>             binary clip, e.g. for LittleFS
+    clipc.py <clip.txt>... --header <file.h>      C header with one flash array per clip
+
+Text format, one command per line, ';' starts a comment:
+    loop                        clip starts over after the last frame
+    frame [steps]               new keyframe shown for steps animation steps (default 1),
+                                it starts with the LED's of the previous keyframe
+    clear                       all LED's off
+    led <i>[-<j>] <colour>      LED's i to j by strip index
+    at <row>,<col> <colour>     LED at a lattice position
+    row <row> <colour>          all LED's of a row
+    col <col> <colour>          all LED's of a (slanted) column
+Colours are #rrggbb or 'off' (LED not covered, the layers below show through).
+
+Binary format, little endian:
+    'P' 'L' 'C' version flags(bit0: loop) frameCount(uint16)
+    frame: steps(uint8) runCount(uint8) runs...
+    run:   skip(uint8) length(uint8) [r g b]
+A run starts skip LED's after the end of the previous run of the frame (the first one after
+LED 0) and sets length & 0x7F LED's to one colour. Bit 7 of length turns them off instead,
+without colour bytes. Only the LED's changed since the previous keyframe are stored.
+"""
+
+import argparse
+import os
+import sys
+
+FORMAT_VERSION = 1
+FLAG_LOOP = 0x01
+MAX_RUN = 0x7F
+OFF_RUN = 0x80
+
+# Wiring of the display, see PLedGeometry::wiring()
+ROWS = 7
+COLS = 20
+LED_COUNT = 128
+HEAD = [(3, 0), (1, 2), (2, 1), (3, 1), (4, 0), (5, 0)]
+TAIL = [(2, 19), (3, 19), (4, 18)]
+RUN_LEDS = 7
+RUN_COUNT = 17
+
+
+def wiring(led):
+    if led < len(HEAD):
+        return HEAD[led]
+    run, j = divmod(led - len(HEAD), RUN_LEDS)
+    if run >= RUN_COUNT:
+        return TAIL[led - len(HEAD) - RUN_COUNT * RUN_LEDS]
+    if run % 2 == 0:
+        return (ROWS - 1 - j, run + (j + 1) // 2)
+    return (j, run + 3 - j // 2)
+
+
+POSITIONS = [wiring(led) for led in range(LED_COUNT)]
+ADDRESS = {pos: led for led, pos in enumerate(POSITIONS)}
+
+
+class ClipError(Exception):
+    pass
+
+
+def parse_colour(text):
+    if text == "off":
+        return None
+    if len(text) != 7 or text[0] != "#":
+        raise ClipError("colour must be #rrggbb or off: %s" % text)
+    value = int(text[1:], 16)
+    return ((value >> 16) & 0xFF, (value >> 8) & 0xFF, value & 0xFF)
+
+
+def parse_leds(command, arg):
+    if command == "led":
+        first, _, last = arg.partition("-")
+        first = int(first)
+        last = int(last) if last else first
+        if not 0 <= first <= last < LED_COUNT:
+            raise ClipError("LED's out of range: %s" % arg)
+        return list(range(first, last + 1))
+    if command == "at":
+        row, col = (int(v) for v in arg.split(","))
+        if (row, col) not in ADDRESS:
+            raise ClipError("no LED at %d,%d" % (row, col))
+        return [ADDRESS[(row, col)]]
+    if command == "row":
+        return [led for led, pos in enumerate(POSITIONS) if pos[0] == int(arg)]
+    if command == "col":
+        return [led for led, pos in enumerate(POSITIONS) if pos[1] == int(arg)]
+    raise ClipError("unknown command: %s" % command)
+
+
+def parse(text):
+    """Parse a text clip into (loop, [(steps, [colour per LED])])"""
+    loop = False
+    frames = []
+    state = [None] * LED_COUNT
+    for number, line in enumerate(text.splitlines(), 1):
+        words = line.split(";", 1)[0].split()
+        if not words:
+            continue
+        command = words[0]
+        try:
+            if command == "loop":
+                loop = True
+            elif command == "frame":
+                steps = int(words[1]) if len(words) > 1 else 1
+                if not 1 <= steps <= 255:
+                    raise ClipError("steps must be 1--255")
+                state = list(state)
+                frames.append((steps, state))
+            elif not frames:
+                raise ClipError("'%s' before the first frame" % command)
+            elif command == "clear":
+                state[:] = [None] * LED_COUNT
+            elif len(words) == 3:
+                colour = parse_colour(words[2])
+                for led in parse_leds(command, words[1]):
+                    state[led] = colour
+            else:
+                raise ClipError("cannot parse '%s'" % line.strip())
+        except (ClipError, ValueError, IndexError) as e:
+            raise ClipError("line %d: %s" % (number, e))
+    if not frames:
+        raise ClipError("clip without frames")
+    return loop, [(steps, tuple(leds)) for steps, leds in frames]
+
+
+def encode_frame(previous, current):
+    """Runs of LED's with the same new value, only where the frame changed"""
+    runs = []
+    led = 0
+    end = 0  # LED after the last run
+    while led < LED_COUNT:
+        if current[led] == previous[led]:
+            led += 1
+            continue
+        length = 1
+        while (led + length < LED_COUNT and length < MAX_RUN and current[led + length] == current[led]
+               and current[led + length] != previous[led + length]):
+            length += 1
+        skip = led - end
+        while skip > 255:
+            runs.append(bytes([255, 0]))  # empty run only skips
+            skip -= 255
+        colour = current[led]
+        if colour is None:
+            runs.append(bytes([skip, OFF_RUN | length]))
+        else:
+            runs.append(bytes([skip, length]) + bytes(colour))
+        led += length
+        end = led
+    if len(runs) > 255:
+        raise ClipError("frame with more than 255 runs")
+    return bytes([len(runs)]) + b"".join(runs)
+
+
+def encode(loop, frames):
+    out = bytearray(b"PLC")
+    out.append(FORMAT_VERSION)
+    out.append(FLAG_LOOP if loop else 0)
+    out += len(frames).to_bytes(2, "little")
+    previous = (None,) * LED_COUNT
+    for steps, leds in frames:
+        out.append(steps)
+        out += encode_frame(previous, leds)
+        previous = leds
+    return bytes(out)
+
+
+def c_name(path):
+    name = os.path.splitext(os.path.basename(path))[0]
+    return "CLIP_" + "".join(c if c.isalnum() else "_" for c in name).upper()
+
+
+def header(clips):
+    lines = ["// Animation clips converted by tools/clipc.py from clips/, do not edit.",
+             "#pragma once", "", "#include \"PLedGeometry.h\"", ""]
+    for path, data in clips:
+        lines.append("// %s" % os.path.basename(path))
+        lines.append("inline constexpr uint8_t %s[%d] PLED_FLASH = {" % (c_name(path), len(data)))
+        for i in range(0, len(data), 16):
+            lines.append("    " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+        lines.append("};")
+        lines.append("")
+    return "\n".join(lines)
+
+
+def convert(path):
+    with open(path) as f:
+        return encode(*parse(f.read()))
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description="Convert text animation clips to PLedClip binaries")
+    parser.add_argument("clips", nargs="+", help="text clips")
+    parser.add_argument("-o", "--output", help="binary clip, only with one input")
+    parser.add_argument("--header", help="C header with all clips as flash arrays")
+    args = parser.parse_args(argv)
+    if not args.output and not args.header:
+        parser.error("give -o and/or --header")
+    if args.output and len(args.clips) != 1:
+        parser.error("-o converts exactly one clip")
+    try:
+        clips = [(path, convert(path)) for path in args.clips]
+    except ClipError as e:
+        sys.exit("clipc: %s" % e)
+    if args.output:
+        with open(args.output, "wb") as f:
+            f.write(clips[0][1])
+    if args.header:
+        with open(args.header, "w") as f:
+            f.write(header(clips))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
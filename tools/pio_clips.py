@@ -0,0 +1,18 @@
+"""PlatformIO pre script: converts the clips in clips/ into src/PLedDisp/PLedClips.h when one changed"""
+
+import glob
+import os
+import sys
+
+Import("env")  # noqa: F821
+
+project = env.subst("$PROJECT_DIR")  # noqa: F821
+sys.path.insert(0, os.path.join(project, "tools"))
+import clipc  # noqa: E402
+
+sources = sorted(glob.glob(os.path.join(project, "clips", "*.clip")))
+target = os.path.join(project, "src", "PLedDisp", "PLedClips.h")
+if sources and (not os.path.exists(target) or max(os.path.getmtime(s) for s in sources) > os.path.getmtime(target)):
+    print("Converting animation clips to %s" % os.path.relpath(target, project))
+    if clipc.main(sources + ["--header", target]) != 0:
+        env.Exit(1)  # noqa: F821
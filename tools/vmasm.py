@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+"""Assembler of background programs for the stack machine of PLedVm.
+
+Usage:
+    vmasm.py <program.vm> -o <program.bin>        binary program
+    vmasm.py <program.vm> --c-array <NAME>        C array on stdout
+    vmasm.py <program.vm> --port <serial port>    upload to the clock (needs pyserial)
+
+Text format, one instruction per line, ';' starts a comment:
+    frame:              instructions run once per animation step
+    pixel:              instructions run for every LED, the last one is hsv or rgb
+    push <n>            push -32768--65535, one byte immediate for 0--255
+    load <r>, store <r> registers r0--r7, they keep their values between steps
+    x y led t dup drop swap add sub mul div mod neg and or xor shl shr min max lt eq sel
+    sin8 scale8 noise rand hsv rgb
+The stack effects are listed in src/PLedDisp/PLedVm.h. The program is checked like on the
+clock: there are no jumps, every instruction runs once per step and LED, and the pixel code
+ends with its colour and an empty stack.
+
+Example, a slowly drifting plasma:
+    frame:
+        t dup add store r0          ; r0 = 2 * t
+    pixel:
+        x push 24 mul load r0 add sin8
+        y push 40 mul t add sin8 add push 1 shr     ; hue
+        push 240                                    ; saturation
+        x push 64 mul y push 64 mul t push 8 mul add noise
+        push 2 shr push 128 add                     ; value
+        hsv
+
+Binary format: 'V' version frameLength pixelLength, frame code, pixel code
+"""
+
+import argparse
+import sys
+
+FORMAT_VERSION = 1
+CODE_MAX = 255
+STACK_SIZE = 16
+REGISTERS = 8
+LED_COUNT = 128
+INSTRUCTION_BUDGET = 8192
+
+# name: (opcode, pops, pushes, pixel only), see PLedVm::Op
+OPS = {
+    "x": (0x03, 0, 1, True), "y": (0x04, 0, 1, True), "led": (0x05, 0, 1, True), "t": (0x06, 0, 1, False),
+    "dup": (0x09, 1, 2, False), "drop": (0x0A, 1, 0, False), "swap": (0x0B, 2, 2, False),
+    "add": (0x10, 2, 1, False), "sub": (0x11, 2, 1, False), "mul": (0x12, 2, 1, False),
+    "div": (0x13, 2, 1, False), "mod": (0x14, 2, 1, False), "neg": (0x15, 1, 1, False),
+    "and": (0x16, 2, 1, False), "or": (0x17, 2, 1, False), "xor": (0x18, 2, 1, False),
+    "shl": (0x19, 2, 1, False), "shr": (0x1A, 2, 1, False), "min": (0x1B, 2, 1, False),
+    "max": (0x1C, 2, 1, False), "lt": (0x1D, 2, 1, False), "eq": (0x1E, 2, 1, False),
+    "sel": (0x1F, 3, 1, False), "sin8": (0x20, 1, 1, False), "scale8": (0x21, 2, 1, False),
+    "noise": (0x22, 2, 1, False), "rand": (0x23, 0, 1, False),
+    "hsv": (0x30, 3, 0, True), "rgb": (0x31, 3, 0, True),
+}
+PUSH = 0x01
+PUSH16 = 0x02
+LOAD = 0x07
+STORE = 0x08
+COLOURS = ("hsv", "rgb")
+
+
+class AsmError(Exception):
+    pass
+
+
+def register(word):
+    value = int(word[1:] if word.startswith("r") else word)
+    if not 0 <= value < REGISTERS:
+        raise AsmError("register must be r0--r%d: %s" % (REGISTERS - 1, word))
+    return value
+
+
+class Part:
+    def __init__(self, pixel):
+        self.pixel = pixel
+        self.code = bytearray()
+        self.count = 0
+        self.depth = 0
+        self.last = None
+
+    def add(self, name, pops, pushes, code):
+        if self.last in COLOURS:
+            raise AsmError("'%s' after the colour" % name)
+        if self.depth < pops:
+            raise AsmError("'%s' needs %d values on the stack" % (name, pops))
+        self.depth += pushes - pops
+        if self.depth > STACK_SIZE:
+            raise AsmError("more than %d values on the stack" % STACK_SIZE)
+        self.code += code
+        self.count += 1
+        self.last = name
+
+
+def assemble(text):
+    parts = {"frame": Part(False), "pixel": Part(True)}
+    part = None
+    for number, line in enumerate(text.splitlines(), 1):
+        words = line.split(";", 1)[0].split()
+        try:
+            i = 0
+            while i < len(words):
+                word = words[i].lower()
+                i += 1
+                if word.endswith(":") and word[:-1] in parts:
+                    part = parts[word[:-1]]
+                    continue
+                if part is None:
+                    raise AsmError("'%s' before frame: or pixel:" % word)
+                if word in ("push", "load", "store"):
+                    if i == len(words):
+                        raise AsmError("'%s' without operand" % word)
+                    operand = words[i]
+                    i += 1
+                    if word == "push":
+                        value = int(operand, 0)
+                        if 0 <= value <= 255:
+                            part.add(word, 0, 1, bytes([PUSH, value]))
+                        elif -32768 <= value <= 65535:
+                            part.add(word, 0, 1, bytes([PUSH16]) + (value & 0xFFFF).to_bytes(2, "little"))
+                        else:
+                            raise AsmError("push out of range: %s" % operand)
+                    elif word == "load":
+                        part.add(word, 0, 1, bytes([LOAD, register(operand)]))
+                    else:
+                        part.add(word, 1, 0, bytes([STORE, register(operand)]))
+                elif word in OPS:
+                    opcode, pops, pushes, pixel_only = OPS[word]
+                    if pixel_only and not part.pixel:
+                        raise AsmError("'%s' only in the pixel code" % word)
+                    part.add(word, pops, pushes, bytes([opcode]))
+                else:
+                    raise AsmError("unknown instruction: %s" % word)
+        except ValueError as e:
+            raise AsmError("line %d: %s" % (number, e))
+        except AsmError as e:
+            raise AsmError("line %d: %s" % (number, e))
+
+    frame, pixel = parts["frame"], parts["pixel"]
+    if frame.depth != 0:
+        raise AsmError("frame code leaves %d values on the stack" % frame.depth)
+    if pixel.last not in COLOURS or pixel.depth != 0:
+        raise AsmError("pixel code must end with hsv or rgb and an empty stack")
+    if len(frame.code) + len(pixel.code) > CODE_MAX:
+        raise AsmError("code longer than %d bytes" % CODE_MAX)
+    instructions = frame.count + LED_COUNT * pixel.count
+    if instructions > INSTRUCTION_BUDGET:
+        raise AsmError("%d instructions per step, budget %d" % (instructions, INSTRUCTION_BUDGET))
+    return bytes([ord("V"), FORMAT_VERSION, len(frame.code), len(pixel.code)]) + frame.code + pixel.code
+
+
+def c_array(name, data):
+    lines = ["static const uint8_t %s[%d] = {" % (name, len(data))]
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def upload(port, data):
+    import serial  # pyserial, only needed here
+
+    with serial.Serial(port, 115200, timeout=2) as s:
+        s.write(data)
+        print(s.readline().decode(errors="replace").strip())
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description="Assemble background programs for PLedVm")
+    parser.add_argument("program", help="text program")
+    parser.add_argument("-o", "--output", help="binary program")
+    parser.add_argument("--c-array", metavar="NAME", help="print the program as C array")
+    parser.add_argument("--port", help="upload the program over this serial port")
+    args = parser.parse_args(argv)
+    if not args.output and not args.c_array and not args.port:
+        parser.error("give -o, --c-array and/or --port")
+    try:
+        with open(args.program) as f:
+            data = assemble(f.read())
+    except AsmError as e:
+        sys.exit("vmasm: %s" % e)
+    if args.output:
+        with open(args.output, "wb") as f:
+            f.write(data)
+    if args.c_array:
+        print(c_array(args.c_array, data))
+    if args.port:
+        upload(args.port, data)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))